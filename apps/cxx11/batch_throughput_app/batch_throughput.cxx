@@ -0,0 +1,239 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+// include both the standard APIs and extensions
+#include <rti/rti.hpp>
+#include <rti/core/cond/AsyncWaitSet.hpp>
+#include <rti/distlogger/DistLogger.hpp>
+#include <rti/config/Logger.hpp>
+
+//
+// For more information about the headers and namespaces, see:
+//    https://community.rti.com/static/documentation/connext-dds/7.3.0/doc/api/connext_dds/api_cpp2/group__DDSNamespaceModule.html
+// For information on how to use extensions, see:
+//    https://community.rti.com/static/documentation/connext-dds/7.3.0/doc/api/connext_dds/api_cpp2/group__DDSCpp2Conventions.html
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "ExampleTypes.hpp"
+#include "Definitions.hpp"
+#include "DDSAsyncLogger.hpp"
+#include "DDSParticipantSetup.hpp"
+#include "DDSPerfTelemetry.hpp"
+#include "DDSReaderSetup.hpp"
+#include "DDSWriterSetup.hpp"
+
+// For example legibility.
+using namespace rti::all;
+using namespace rti::dist_logger;
+
+constexpr int ASYNC_WAITSET_THREADPOOL_SIZE = 5;
+const std::string APP_NAME = "Batch Throughput CXX APP";
+
+// Publish in bursts and flush the partial batch at the end of each burst;
+// between bursts the writer is idle, so without the flush the tail samples
+// would wait out the profile's max_flush_delay
+constexpr int SAMPLES_PER_BURST = 5000;
+constexpr int BURST_INTERVAL_MS = 100;
+
+// Rate reports once per second on both sides
+constexpr int REPORT_INTERVAL_SEC = 1;
+
+
+void run_publisher(std::shared_ptr<DDSParticipantSetup> participant_setup)
+{
+    auto &rti_logger = rti::config::Logger::instance();
+
+    rti_logger.notice("Batch throughput publisher starting...");
+
+    // Setup Writer Interface with the batching profile. Each write() call
+    // only appends to the writer's current batch; the middleware flushes a
+    // full RTPS message when the batch hits the profile's size or time
+    // threshold, so 5000 writes turn into a few dozen datagrams.
+    auto telemetry_writer =
+            std::make_shared<DDSWriterSetup<example_types::Position>>(
+                    participant_setup,
+                    topics::TELEMETRY_TOPIC,
+                    qos_profiles::HIGH_THROUGHPUT_BATCH);
+
+    rti_logger.notice("Waiting for a subscriber before publishing...");
+    telemetry_writer->wait_for_drs_to_match(1);
+
+    example_types::Position telemetry;
+    telemetry.source_id("TELEMETRY_NODE_1");
+    telemetry.altitude(120.0);
+
+    unsigned long samples_sent = 0;
+    unsigned long samples_at_last_report = 0;
+    auto last_report = std::chrono::steady_clock::now();
+
+    while (!application::shutdown_requested) {
+        try {
+            // Batch-aware write loop: plain write() calls back to back -
+            // batching happens inside the middleware
+            for (int i = 0; i < SAMPLES_PER_BURST; i++) {
+                telemetry.latitude(37.0 + (samples_sent % 1000) * 1e-6);
+                telemetry.longitude(-122.0 + (samples_sent % 1000) * 1e-6);
+                telemetry.timestamp_sec(
+                        static_cast<uint32_t>(samples_sent / SAMPLES_PER_BURST));
+                telemetry_writer->writer().write(telemetry);
+                samples_sent++;
+            }
+
+            // Push out the partial batch now that the burst is over
+            telemetry_writer->flush();
+        } catch (const std::exception &ex) {
+            rti_logger.error(
+                    ("Failed to publish telemetry: " + std::string(ex.what()))
+                            .c_str());
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_report >= std::chrono::seconds(REPORT_INTERVAL_SEC)) {
+            auto elapsed_ms =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                            now - last_report)
+                            .count();
+            auto rate = (samples_sent - samples_at_last_report) * 1000
+                    / elapsed_ms;
+            DDS_LOG_INFO(
+                    "Published " + std::to_string(samples_sent) + " samples ("
+                    + std::to_string(rate) + "/s)");
+            samples_at_last_report = samples_sent;
+            last_report = now;
+        }
+
+        std::this_thread::sleep_for(
+                std::chrono::milliseconds(BURST_INTERVAL_MS));
+    }
+
+    rti_logger.notice("Batch throughput publisher shutting down...");
+}
+
+void run_subscriber(std::shared_ptr<DDSParticipantSetup> participant_setup)
+{
+    auto &rti_logger = rti::config::Logger::instance();
+
+    rti_logger.notice("Batch throughput subscriber starting...");
+
+    auto telemetry_reader =
+            std::make_shared<DDSReaderSetup<example_types::Position>>(
+                    participant_setup,
+                    topics::TELEMETRY_TOPIC,
+                    qos_profiles::HIGH_THROUGHPUT_BATCH);
+
+    // Batches arrive whole: one condition trigger delivers every sample the
+    // writer flushed in one RTPS message
+    std::atomic<unsigned long> samples_received(0);
+    telemetry_reader->set_loaned_batch_handler(
+            [&samples_received](
+                    rti::sub::LoanedSamples<example_types::Position> &samples) {
+                for (const auto &sample : samples) {
+                    if (sample.info().valid()) {
+                        samples_received++;
+                    }
+                }
+            });
+
+    rti_logger.notice("Subscribing to telemetry... Press Ctrl+C to stop.");
+
+    unsigned long samples_at_last_report = 0;
+    while (!application::shutdown_requested) {
+        std::this_thread::sleep_for(std::chrono::seconds(REPORT_INTERVAL_SEC));
+
+        unsigned long total = samples_received.load();
+        DDS_LOG_INFO(
+                "Received " + std::to_string(total) + " samples ("
+                + std::to_string(
+                        (total - samples_at_last_report) / REPORT_INTERVAL_SEC)
+                + "/s)");
+        samples_at_last_report = total;
+    }
+
+    rti_logger.notice("Batch throughput subscriber shutting down...");
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    // Setup and Run the application
+    try {
+        // Create DDS Participant Setup (creates DomainParticipant and
+        // AsyncWaitSet)
+        auto participant_setup = std::make_shared<DDSParticipantSetup>(
+                arguments.domain_id,
+                ASYNC_WAITSET_THREADPOOL_SIZE,
+                arguments.qos_file_path,
+                qos_profiles::DEFAULT_PARTICIPANT,
+                APP_NAME);
+
+        // Setup Distributed Logger Singleton
+        // This publishes the RTI logs over DDS the network, enabling
+        // centralized logging and monitoring across distributed systems.
+        DistLoggerOptions options;
+        options.domain_participant(participant_setup->participant());
+        options.application_kind(APP_NAME);
+        DistLogger::set_options(options);
+        auto &dist_logger = DistLogger::get_instance();
+
+        dist_logger.set_verbosity(
+                rti::config::LogCategory::user,
+                arguments.verbosity);
+        dist_logger.set_filter_level(dist_logger.get_info_log_level());
+
+        // Publish the wrappers' per-entity performance counters once a
+        // second (EntityPerfCounters topic, StatusQoS) for rti_view
+        DDSPerfTelemetry::instance().enable_publishing(
+                participant_setup,
+                APP_NAME);
+
+        // Run the selected role
+        if (arguments.role == AppRole::publisher) {
+            run_publisher(participant_setup);
+        } else {
+            run_subscriber(participant_setup);
+        }
+
+        // Stop the telemetry publisher before the participant goes away
+        DDSPerfTelemetry::instance().disable_publishing();
+
+        // Explicitly finalize DistLogger Singleton
+        // before Domain Participant destruction
+        DistLogger::get_instance().finalize();
+        std::cout << "DistLogger finalized" << std::endl;
+
+    } catch (const std::exception &ex) {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Finalize participant factory after all DDS entities are cleaned up
+    dds::domain::DomainParticipant::finalize_participant_factory();
+    std::cout << "DomainParticipant factory finalized at application exit"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
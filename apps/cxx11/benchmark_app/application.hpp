@@ -0,0 +1,263 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef APPLICATION_HPP
+#define APPLICATION_HPP
+
+#include <iostream>
+#include <csignal>
+#include <string>
+#include <dds/core/ddscore.hpp>
+#include "Definitions.hpp"
+
+namespace application {
+
+    // Catch control-C and tell application to shut down
+    bool shutdown_requested = false;
+
+    inline void stop_handler(int)
+    {
+        shutdown_requested = true;
+        std::cout << "preparing to shut down..." << std::endl;
+    }
+
+    inline void setup_signal_handlers()
+    {
+        signal(SIGINT, stop_handler);
+        signal(SIGTERM, stop_handler);
+    }
+
+    enum class ParseReturn {
+        ok,
+        failure,
+        exit
+    };
+
+    // Which end of the benchmark this process is
+    enum class BenchmarkRole {
+        ping,       // latency initiator: sends, waits for echo, records RTT
+        pong,       // latency responder: echoes every sample back
+        stream_pub, // throughput publisher: sends as fast as possible
+        stream_sub  // throughput subscriber: counts samples and bytes
+    };
+
+    // Which data type the benchmark exercises
+    enum class BenchmarkType {
+        flat_image, // example_types::FinalFlatImage (FlatData, fixed 3 MB)
+        pointcloud  // foxglove::PointCloud (plain type, variable payload)
+    };
+
+    struct ApplicationArguments {
+        ParseReturn parse_result;
+        unsigned int domain_id;
+        rti::config::Verbosity verbosity;
+        std::string qos_file_path;
+        BenchmarkRole role;
+        BenchmarkType type;
+        std::string qos_profile;
+        unsigned int payload_size;
+        unsigned int sample_count;
+        unsigned int duration;
+
+        ApplicationArguments(
+            ParseReturn parse_result_param,
+            unsigned int domain_id_param,
+            rti::config::Verbosity verbosity_param,
+            const std::string& qos_file_path_param,
+            BenchmarkRole role_param = BenchmarkRole::ping,
+            BenchmarkType type_param = BenchmarkType::pointcloud,
+            const std::string& qos_profile_param = "",
+            unsigned int payload_size_param = 65536,
+            unsigned int sample_count_param = 10000,
+            unsigned int duration_param = 10)
+            : parse_result(parse_result_param),
+              domain_id(domain_id_param),
+              verbosity(verbosity_param),
+              qos_file_path(qos_file_path_param),
+              role(role_param),
+              type(type_param),
+              qos_profile(qos_profile_param),
+              payload_size(payload_size_param),
+              sample_count(sample_count_param),
+              duration(duration_param) {}
+    };
+
+    inline void set_verbosity(
+        rti::config::Verbosity& verbosity,
+        int verbosity_value)
+    {
+        switch (verbosity_value) {
+            case 0:
+            verbosity = rti::config::Verbosity::SILENT;
+            break;
+            case 1:
+            verbosity = rti::config::Verbosity::EXCEPTION;
+            break;
+            case 2:
+            verbosity = rti::config::Verbosity::WARNING;
+            break;
+            case 3:
+            verbosity = rti::config::Verbosity::STATUS_ALL;
+            break;
+            default:
+            verbosity = rti::config::Verbosity::EXCEPTION;
+            break;
+        }
+    }
+
+    // Parses application arguments for example.
+    inline ApplicationArguments parse_arguments(int argc, char *argv[], const std::string& app_description)
+    {
+        int arg_processing = 1;
+        bool show_usage = false;
+        ParseReturn parse_result = ParseReturn::ok;
+        unsigned int domain_id = domains::DEFAULT_DOMAIN_ID;
+        rti::config::Verbosity verbosity(rti::config::Verbosity::EXCEPTION);
+        std::string qos_file_path = "dds/qos/DDS_QOS_PROFILES.xml"; // Default QoS file
+        BenchmarkRole role = BenchmarkRole::ping;
+        BenchmarkType type = BenchmarkType::pointcloud;
+        std::string qos_profile = qos_profiles::BURST_LARGE_DATA_UDP; // Default profile
+        unsigned int payload_size = 65536; // Default: 64 KB pointcloud payload
+        unsigned int sample_count = 10000; // Default: 10k ping-pong round trips
+        unsigned int duration = 10; // Default: 10 seconds of streaming
+
+        while (arg_processing < argc) {
+            if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-d") == 0
+            || strcmp(argv[arg_processing], "--domain") == 0)) {
+                domain_id = atoi(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-v") == 0
+            || strcmp(argv[arg_processing], "--verbosity") == 0)) {
+                set_verbosity(verbosity, atoi(argv[arg_processing + 1]));
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-q") == 0
+            || strcmp(argv[arg_processing], "--qos-file") == 0)) {
+                qos_file_path = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-r") == 0
+            || strcmp(argv[arg_processing], "--role") == 0)) {
+                std::string role_name = argv[arg_processing + 1];
+                if (role_name == "ping") {
+                    role = BenchmarkRole::ping;
+                } else if (role_name == "pong") {
+                    role = BenchmarkRole::pong;
+                } else if (role_name == "pub") {
+                    role = BenchmarkRole::stream_pub;
+                } else if (role_name == "sub") {
+                    role = BenchmarkRole::stream_sub;
+                } else {
+                    std::cout << "Bad role: " << role_name << std::endl;
+                    show_usage = true;
+                    parse_result = ParseReturn::failure;
+                    break;
+                }
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-t") == 0
+            || strcmp(argv[arg_processing], "--type") == 0)) {
+                std::string type_name = argv[arg_processing + 1];
+                if (type_name == "flat_image") {
+                    type = BenchmarkType::flat_image;
+                } else if (type_name == "pointcloud") {
+                    type = BenchmarkType::pointcloud;
+                } else {
+                    std::cout << "Bad type: " << type_name << std::endl;
+                    show_usage = true;
+                    parse_result = ParseReturn::failure;
+                    break;
+                }
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-p") == 0
+            || strcmp(argv[arg_processing], "--profile") == 0)) {
+                std::string profile_name = argv[arg_processing + 1];
+                if (profile_name == "shmem") {
+                    qos_profile = qos_profiles::LARGE_DATA_SHMEM;
+                } else if (profile_name == "shmem_zc") {
+                    qos_profile = qos_profiles::LARGE_DATA_SHMEM_ZC;
+                } else if (profile_name == "burst_udp") {
+                    qos_profile = qos_profiles::BURST_LARGE_DATA_UDP;
+                } else {
+                    std::cout << "Bad profile: " << profile_name << std::endl;
+                    show_usage = true;
+                    parse_result = ParseReturn::failure;
+                    break;
+                }
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-s") == 0
+            || strcmp(argv[arg_processing], "--payload") == 0)) {
+                payload_size = atoi(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-n") == 0
+            || strcmp(argv[arg_processing], "--samples") == 0)) {
+                sample_count = atoi(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-D") == 0
+            || strcmp(argv[arg_processing], "--duration") == 0)) {
+                duration = atoi(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if (strcmp(argv[arg_processing], "-h") == 0
+            || strcmp(argv[arg_processing], "--help") == 0) {
+                std::cout << app_description << std::endl;
+                show_usage = true;
+                parse_result = ParseReturn::exit;
+                break;
+            } else {
+                std::cout << "Bad parameter." << std::endl;
+                show_usage = true;
+                parse_result = ParseReturn::failure;
+                break;
+            }
+        }
+        if (show_usage) {
+            std::cout << "Usage:\n"\
+            "    -d, --domain       <int>   Domain ID this application will\n" \
+            "                               use.  \n"
+            "                               Default: 1\n"\
+            "    -v, --verbosity    <int>   How much debugging output to show.\n"\
+            "                               Range: 0-3 \n"
+            "                               Default: 1\n"
+            "    -q, --qos-file     <str>   Path to QoS profile XML file.\n"\
+            "                               Default: dds/qos/DDS_QOS_PROFILES.xml\n"
+            "    -r, --role         <str>   Benchmark role: ping, pong, pub, sub.\n"\
+            "                               ping/pong = latency round trips,\n"\
+            "                               pub/sub = streaming throughput.\n"\
+            "                               Default: ping\n"
+            "    -t, --type         <str>   Data type: flat_image, pointcloud.\n"\
+            "                               Default: pointcloud\n"
+            "    -p, --profile      <str>   QoS profile: shmem, shmem_zc, burst_udp.\n"\
+            "                               Default: burst_udp\n"
+            "    -s, --payload      <int>   Pointcloud payload size in bytes\n"\
+            "                               (flat_image is always 3 MB).\n"\
+            "                               Default: 65536\n"
+            "    -n, --samples      <int>   Number of ping-pong round trips.\n"\
+            "                               Default: 10000\n"
+            "    -D, --duration     <int>   Streaming duration in seconds.\n"\
+            "                               Default: 10"
+            << std::endl;
+        }
+
+        return ApplicationArguments(
+            parse_result, domain_id, verbosity, qos_file_path,
+            role, type, qos_profile, payload_size, sample_count, duration);
+    }
+
+}  // namespace application
+
+#endif  // APPLICATION_HPP
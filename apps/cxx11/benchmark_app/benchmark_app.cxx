@@ -0,0 +1,680 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+// include both the standard APIs and extensions
+#include <rti/rti.hpp>
+#include <rti/core/cond/AsyncWaitSet.hpp>
+#include <rti/distlogger/DistLogger.hpp>
+#include <rti/config/Logger.hpp>
+
+//
+// For more information about the headers and namespaces, see:
+//    https://community.rti.com/static/documentation/connext-dds/7.3.0/doc/api/connext_dds/api_cpp2/group__DDSNamespaceModule.html
+// For information on how to use extensions, see:
+//    https://community.rti.com/static/documentation/connext-dds/7.3.0/doc/api/connext_dds/api_cpp2/group__DDSCpp2Conventions.html
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "ExampleTypes.hpp"
+#include "Definitions.hpp"
+#include "DDSParticipantSetup.hpp"
+#include "DDSReaderSetup.hpp"
+#include "DDSWriterSetup.hpp"
+#include "PointCloud.hpp"
+
+// For example legibility.
+using namespace rti::all;
+using namespace rti::dist_logger;
+
+constexpr int ASYNC_WAITSET_THREADPOOL_SIZE = 5;
+const std::string APP_NAME = "Benchmark app";
+
+// Round trips discarded from the front of every latency run so discovery
+// and allocator warm-up don't skew the percentiles
+const unsigned int WARMUP_SAMPLES = 100;
+
+// How long the initiator waits for a single echo before declaring it lost
+const int PONG_TIMEOUT_MS = 1000;
+
+// How often the streaming subscriber prints an interval report
+const int STREAM_REPORT_PERIOD_MS = 1000;
+
+// Nanoseconds on the steady (monotonic) clock - all latency math uses this
+static uint64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+/*
+ * Records one-way latencies and reports HDR-style percentiles. Samples are
+ * kept in a pre-reserved vector so recording never allocates on the hot
+ * path; the sort happens once at report time.
+ */
+class LatencyRecorder {
+public:
+    explicit LatencyRecorder(size_t expected_samples)
+    {
+        _latencies_ns.reserve(expected_samples);
+    }
+
+    void record(uint64_t latency_ns)
+    {
+        _latencies_ns.push_back(latency_ns);
+    }
+
+    void report(
+            const std::string &qos_profile,
+            const std::string &type_name,
+            size_t payload_bytes)
+    {
+        if (_latencies_ns.empty()) {
+            std::cout << "No latency samples recorded" << std::endl;
+            return;
+        }
+
+        std::sort(_latencies_ns.begin(), _latencies_ns.end());
+
+        uint64_t sum = 0;
+        for (const auto latency : _latencies_ns) {
+            sum += latency;
+        }
+
+        std::cout << "\n=== One-way latency report ===" << std::endl;
+        std::cout << "  Profile: " << qos_profile << ", type: " << type_name
+                  << ", payload: " << payload_bytes << " B, samples: "
+                  << _latencies_ns.size() << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "  min:    " << to_us(_latencies_ns.front()) << " us"
+                  << std::endl;
+        std::cout << "  mean:   " << to_us(sum / _latencies_ns.size())
+                  << " us" << std::endl;
+        std::cout << "  p50:    " << to_us(percentile(50.0)) << " us"
+                  << std::endl;
+        std::cout << "  p99:    " << to_us(percentile(99.0)) << " us"
+                  << std::endl;
+        std::cout << "  p99.9:  " << to_us(percentile(99.9)) << " us"
+                  << std::endl;
+        std::cout << "  max:    " << to_us(_latencies_ns.back()) << " us"
+                  << std::endl;
+    }
+
+private:
+    // Nearest-rank percentile over the sorted samples
+    uint64_t percentile(double pct) const
+    {
+        size_t rank = static_cast<size_t>(
+                (pct / 100.0) * static_cast<double>(_latencies_ns.size()));
+        if (rank >= _latencies_ns.size()) {
+            rank = _latencies_ns.size() - 1;
+        }
+        return _latencies_ns[rank];
+    }
+
+    static double to_us(uint64_t ns)
+    {
+        return static_cast<double>(ns) / 1000.0;
+    }
+
+    std::vector<uint64_t> _latencies_ns;
+};
+
+/*
+ * Tracks one round trip at a time: the initiator publishes the next ping
+ * only after the previous echo arrived (or timed out), so the sequence
+ * number is enough to correlate ping and pong.
+ */
+struct PongTracker {
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint64_t received_seq = 0;
+    bool received = false;
+
+    void signal(uint64_t seq)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            received_seq = seq;
+            received = true;
+        }
+        cv.notify_one();
+    }
+
+    // Returns true when the echo for expected_seq arrived within the timeout
+    bool wait_for(uint64_t expected_seq)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        const bool ok = cv.wait_for(
+                lock,
+                std::chrono::milliseconds(PONG_TIMEOUT_MS),
+                [this, expected_seq] {
+                    return received && received_seq == expected_seq;
+                });
+        received = false;
+        return ok;
+    }
+};
+
+// Build a pointcloud sample carrying payload_size raw bytes. The sequence
+// number travels in timestamp.sec for ping/pong correlation.
+static ::foxglove::PointCloud make_pointcloud(unsigned int payload_size)
+{
+    ::foxglove::PointCloud cloud;
+    cloud.frame_id("benchmark");
+    cloud.point_stride(1);
+    cloud.data(std::vector<uint8_t>(payload_size, 0xAB));
+    return cloud;
+}
+
+// ----------------------------------------------------------------------------
+// Ping-pong latency: foxglove::PointCloud
+// ----------------------------------------------------------------------------
+
+void run_ping_pointcloud(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args)
+{
+    auto ping_writer = std::make_shared<DDSWriterSetup<::foxglove::PointCloud>>(
+            participant_setup,
+            topics::BENCHMARK_PING_TOPIC,
+            args.qos_profile);
+
+    auto pong_reader = std::make_shared<DDSReaderSetup<::foxglove::PointCloud>>(
+            participant_setup,
+            topics::BENCHMARK_PONG_TOPIC,
+            args.qos_profile);
+
+    PongTracker tracker;
+    pong_reader->set_loaned_batch_handler(
+            [&tracker](rti::sub::LoanedSamples<::foxglove::PointCloud> &samples) {
+                for (const auto &sample : samples) {
+                    if (sample.info().valid()) {
+                        tracker.signal(sample.data().timestamp().sec());
+                    }
+                }
+            });
+
+    // Both directions must be discovered before timing starts
+    ping_writer->wait_for_drs_to_match(1);
+
+    auto cloud = make_pointcloud(args.payload_size);
+    auto writer = ping_writer->writer();
+
+    LatencyRecorder recorder(args.sample_count);
+    unsigned int lost = 0;
+
+    for (uint64_t seq = 0;
+         seq < args.sample_count + WARMUP_SAMPLES
+         && !application::shutdown_requested;
+         seq++) {
+        cloud.timestamp(::foxglove::Time(static_cast<uint32_t>(seq), 0));
+
+        const uint64_t t0 = now_ns();
+        writer.write(cloud);
+
+        if (tracker.wait_for(seq)) {
+            // One-way latency is half the measured round trip
+            if (seq >= WARMUP_SAMPLES) {
+                recorder.record((now_ns() - t0) / 2);
+            }
+        } else {
+            lost++;
+        }
+    }
+
+    if (lost > 0) {
+        std::cout << "Round trips timed out: " << lost << std::endl;
+    }
+    recorder.report(args.qos_profile, "pointcloud", args.payload_size);
+}
+
+void run_pong_pointcloud(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args)
+{
+    auto pong_writer = std::make_shared<DDSWriterSetup<::foxglove::PointCloud>>(
+            participant_setup,
+            topics::BENCHMARK_PONG_TOPIC,
+            args.qos_profile);
+
+    auto ping_reader = std::make_shared<DDSReaderSetup<::foxglove::PointCloud>>(
+            participant_setup,
+            topics::BENCHMARK_PING_TOPIC,
+            args.qos_profile);
+
+    auto writer = pong_writer->writer();
+
+    // Echo every valid ping straight back, payload included, so the round
+    // trip exercises serialization in both directions
+    ping_reader->set_loaned_batch_handler(
+            [writer](rti::sub::LoanedSamples<::foxglove::PointCloud> &samples) mutable {
+                for (const auto &sample : samples) {
+                    if (sample.info().valid()) {
+                        writer.write(sample.data());
+                    }
+                }
+            });
+
+    std::cout << "Pong responder running. Press Ctrl+C to stop." << std::endl;
+    while (!application::shutdown_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Ping-pong latency: example_types::FinalFlatImage (FlatData)
+// ----------------------------------------------------------------------------
+
+void run_ping_flat_image(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args)
+{
+    auto ping_writer =
+            std::make_shared<DDSWriterSetup<example_types::FinalFlatImage>>(
+                    participant_setup,
+                    topics::BENCHMARK_PING_TOPIC,
+                    args.qos_profile);
+
+    auto pong_reader =
+            std::make_shared<DDSReaderSetup<example_types::FinalFlatImage>>(
+                    participant_setup,
+                    topics::BENCHMARK_PONG_TOPIC,
+                    args.qos_profile);
+
+    PongTracker tracker;
+    pong_reader->set_loaned_batch_handler(
+            [&tracker](rti::sub::LoanedSamples<example_types::FinalFlatImage>
+                               &samples) {
+                for (const auto &sample : samples) {
+                    if (sample.info().valid()) {
+                        tracker.signal(sample.data().root().image_id());
+                    }
+                }
+            });
+
+    ping_writer->wait_for_drs_to_match(1);
+
+    auto writer = ping_writer->writer();
+
+    LatencyRecorder recorder(args.sample_count);
+    unsigned int lost = 0;
+
+    for (uint64_t seq = 0;
+         seq < args.sample_count + WARMUP_SAMPLES
+         && !application::shutdown_requested;
+         seq++) {
+        // Zero-copy FlatData API for @final types using get_loan(). The
+        // fixed-size data array always travels at full capacity, so only
+        // the correlation id needs to be set per round trip.
+        auto sample = writer->get_loan();
+        auto root = sample->root();
+        root.image_id(static_cast<uint32_t>(seq));
+        root.width(0);
+        root.height(0);
+        root.format(0);
+
+        const uint64_t t0 = now_ns();
+        writer.write(*sample);
+
+        if (tracker.wait_for(seq)) {
+            if (seq >= WARMUP_SAMPLES) {
+                recorder.record((now_ns() - t0) / 2);
+            }
+        } else {
+            lost++;
+        }
+    }
+
+    if (lost > 0) {
+        std::cout << "Round trips timed out: " << lost << std::endl;
+    }
+    recorder.report(
+            args.qos_profile,
+            "flat_image",
+            example_types::MAX_IMAGE_DATA_SIZE);
+}
+
+void run_pong_flat_image(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args)
+{
+    auto pong_writer =
+            std::make_shared<DDSWriterSetup<example_types::FinalFlatImage>>(
+                    participant_setup,
+                    topics::BENCHMARK_PONG_TOPIC,
+                    args.qos_profile);
+
+    auto ping_reader =
+            std::make_shared<DDSReaderSetup<example_types::FinalFlatImage>>(
+                    participant_setup,
+                    topics::BENCHMARK_PING_TOPIC,
+                    args.qos_profile);
+
+    auto writer = pong_writer->writer();
+
+    // Echo only the correlation id - the fixed-size FlatData array has the
+    // same wire size either way, so the echo direction still carries a
+    // full-size sample without a 3 MB copy on the responder
+    ping_reader->set_loaned_batch_handler(
+            [writer](rti::sub::LoanedSamples<example_types::FinalFlatImage>
+                             &samples) mutable {
+                for (const auto &sample : samples) {
+                    if (sample.info().valid()) {
+                        auto echo = writer->get_loan();
+                        auto root = echo->root();
+                        root.image_id(sample.data().root().image_id());
+                        root.width(0);
+                        root.height(0);
+                        root.format(0);
+                        writer.write(*echo);
+                    }
+                }
+            });
+
+    std::cout << "Pong responder running. Press Ctrl+C to stop." << std::endl;
+    while (!application::shutdown_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Streaming throughput
+// ----------------------------------------------------------------------------
+
+void run_stream_pub_pointcloud(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args)
+{
+    auto stream_writer =
+            std::make_shared<DDSWriterSetup<::foxglove::PointCloud>>(
+                    participant_setup,
+                    topics::BENCHMARK_STREAM_TOPIC,
+                    args.qos_profile);
+
+    stream_writer->wait_for_drs_to_match(1);
+
+    auto cloud = make_pointcloud(args.payload_size);
+    auto writer = stream_writer->writer();
+
+    const auto deadline = std::chrono::steady_clock::now()
+            + std::chrono::seconds(args.duration);
+    uint64_t samples_written = 0;
+
+    while (std::chrono::steady_clock::now() < deadline
+           && !application::shutdown_requested) {
+        writer.write(cloud);
+        samples_written++;
+    }
+
+    std::cout << "Streamed " << samples_written << " pointcloud samples ("
+              << args.payload_size << " B payload) in " << args.duration
+              << " s" << std::endl;
+
+    try {
+        writer.wait_for_acknowledgments(dds::core::Duration(5, 0));
+    } catch (const dds::core::TimeoutError &) {
+        std::cout << "Timeout: Not all samples were acknowledged in time."
+                  << std::endl;
+    }
+}
+
+void run_stream_pub_flat_image(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args)
+{
+    auto stream_writer =
+            std::make_shared<DDSWriterSetup<example_types::FinalFlatImage>>(
+                    participant_setup,
+                    topics::BENCHMARK_STREAM_TOPIC,
+                    args.qos_profile);
+
+    stream_writer->wait_for_drs_to_match(1);
+
+    auto writer = stream_writer->writer();
+
+    const auto deadline = std::chrono::steady_clock::now()
+            + std::chrono::seconds(args.duration);
+    uint64_t samples_written = 0;
+
+    while (std::chrono::steady_clock::now() < deadline
+           && !application::shutdown_requested) {
+        auto sample = writer->get_loan();
+        auto root = sample->root();
+        root.image_id(static_cast<uint32_t>(samples_written));
+        root.width(0);
+        root.height(0);
+        root.format(0);
+        writer.write(*sample);
+        samples_written++;
+    }
+
+    std::cout << "Streamed " << samples_written << " flat image samples ("
+              << example_types::MAX_IMAGE_DATA_SIZE << " B payload) in "
+              << args.duration << " s" << std::endl;
+
+    try {
+        writer.wait_for_acknowledgments(dds::core::Duration(5, 0));
+    } catch (const dds::core::TimeoutError &) {
+        std::cout << "Timeout: Not all samples were acknowledged in time."
+                  << std::endl;
+    }
+}
+
+// Streaming subscriber shared by both types: the batch handler only bumps
+// counters, and the main loop prints an interval report every second plus a
+// final sustained-throughput summary. bytes_of extracts the payload size of
+// one sample.
+template <typename T>
+void run_stream_sub(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &args,
+        const std::string &type_name,
+        std::function<size_t(const dds::sub::Sample<T> &)> bytes_of)
+{
+    auto stream_reader = std::make_shared<DDSReaderSetup<T>>(
+            participant_setup,
+            topics::BENCHMARK_STREAM_TOPIC,
+            args.qos_profile);
+
+    std::atomic<uint64_t> samples_received(0);
+    std::atomic<uint64_t> bytes_received(0);
+
+    stream_reader->set_loaned_batch_handler(
+            [&samples_received, &bytes_received, bytes_of](
+                    rti::sub::LoanedSamples<T> &samples) {
+                for (const auto &sample : samples) {
+                    if (sample.info().valid()) {
+                        samples_received.fetch_add(1);
+                        bytes_received.fetch_add(bytes_of(sample));
+                    }
+                }
+            });
+
+    stream_reader->set_sample_lost_handler([](dds::sub::DataReader<T> &reader) {
+        auto status = reader.sample_lost_status();
+        std::cout << "Sample lost! Total lost: " << status.total_count()
+                  << std::endl;
+    });
+
+    std::cout << "Streaming subscriber running. Press Ctrl+C to stop."
+              << std::endl;
+
+    const uint64_t start_ns = now_ns();
+    uint64_t last_samples = 0;
+    uint64_t last_bytes = 0;
+
+    while (!application::shutdown_requested) {
+        std::this_thread::sleep_for(
+                std::chrono::milliseconds(STREAM_REPORT_PERIOD_MS));
+
+        const uint64_t samples = samples_received.load();
+        const uint64_t bytes = bytes_received.load();
+        std::cout << "  " << (samples - last_samples) << " samples/s, "
+                  << std::fixed << std::setprecision(1)
+                  << static_cast<double>(bytes - last_bytes) / 1.0e6
+                  << " MB/s" << std::endl;
+        last_samples = samples;
+        last_bytes = bytes;
+    }
+
+    const double elapsed_s =
+            static_cast<double>(now_ns() - start_ns) / 1.0e9;
+    const uint64_t samples = samples_received.load();
+    const uint64_t bytes = bytes_received.load();
+
+    std::cout << "\n=== Throughput report ===" << std::endl;
+    std::cout << "  Profile: " << args.qos_profile << ", type: " << type_name
+              << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  Sustained: " << static_cast<double>(samples) / elapsed_s
+              << " samples/s, " << static_cast<double>(bytes) / elapsed_s / 1.0e6
+              << " MB/s over " << elapsed_s << " s" << std::endl;
+}
+
+void run(std::shared_ptr<DDSParticipantSetup> participant_setup,
+         const application::ApplicationArguments &args)
+{
+    auto &rti_logger = rti::config::Logger::instance();
+
+    rti_logger.notice(
+            (std::string("Benchmark application starting on domain ")
+             + std::to_string(participant_setup->participant().domain_id()))
+                    .c_str());
+
+    using application::BenchmarkRole;
+    using application::BenchmarkType;
+
+    switch (args.role) {
+    case BenchmarkRole::ping:
+        if (args.type == BenchmarkType::flat_image) {
+            run_ping_flat_image(participant_setup, args);
+        } else {
+            run_ping_pointcloud(participant_setup, args);
+        }
+        break;
+    case BenchmarkRole::pong:
+        if (args.type == BenchmarkType::flat_image) {
+            run_pong_flat_image(participant_setup, args);
+        } else {
+            run_pong_pointcloud(participant_setup, args);
+        }
+        break;
+    case BenchmarkRole::stream_pub:
+        if (args.type == BenchmarkType::flat_image) {
+            run_stream_pub_flat_image(participant_setup, args);
+        } else {
+            run_stream_pub_pointcloud(participant_setup, args);
+        }
+        break;
+    case BenchmarkRole::stream_sub:
+        if (args.type == BenchmarkType::flat_image) {
+            run_stream_sub<example_types::FinalFlatImage>(
+                    participant_setup,
+                    args,
+                    "flat_image",
+                    [](const dds::sub::Sample<example_types::FinalFlatImage> &) {
+                        return static_cast<size_t>(
+                                example_types::MAX_IMAGE_DATA_SIZE);
+                    });
+        } else {
+            run_stream_sub<::foxglove::PointCloud>(
+                    participant_setup,
+                    args,
+                    "pointcloud",
+                    [](const dds::sub::Sample<::foxglove::PointCloud> &sample) {
+                        return sample.data().data().size();
+                    });
+        }
+        break;
+    }
+
+    rti_logger.notice("Benchmark application shutting down...");
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(
+            argc,
+            argv,
+            "Latency/throughput benchmark for the starter kit wrapper "
+            "classes.");
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    // Setup and Run the application
+    try {
+        // Create DDS Participant Setup (creates DomainParticipant and
+        // AsyncWaitSet). The participant profile follows the endpoint
+        // profile: the SHMEM profiles need the large-data participant, the
+        // UDP profile needs the UDP-tuned one.
+        const std::string participant_profile =
+                (arguments.qos_profile == qos_profiles::BURST_LARGE_DATA_UDP)
+                ? qos_profiles::LARGE_DATA_UDP_PARTICIPANT
+                : qos_profiles::LARGE_DATA_PARTICIPANT;
+
+        auto participant_setup = std::make_shared<DDSParticipantSetup>(
+                arguments.domain_id,
+                ASYNC_WAITSET_THREADPOOL_SIZE,
+                arguments.qos_file_path,
+                participant_profile,
+                APP_NAME);
+
+        // Setup Distributed Logger Singleton
+        DistLoggerOptions options;
+        options.domain_participant(participant_setup->participant());
+        options.application_kind(APP_NAME);
+        DistLogger::set_options(options);
+        auto &dist_logger = DistLogger::get_instance();
+
+        dist_logger.set_verbosity(
+                rti::config::LogCategory::user,
+                arguments.verbosity);
+        dist_logger.set_filter_level(dist_logger.get_info_log_level());
+
+        // Run
+        run(participant_setup, arguments);
+
+        // Explicitly finalize DistLogger Singleton
+        // before Domain Participant destruction
+        DistLogger::get_instance().finalize();
+        std::cout << "DistLogger finalized" << std::endl;
+
+    } catch (const std::exception &ex) {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Finalize participant factory after all DDS entities are cleaned up
+    dds::domain::DomainParticipant::finalize_participant_factory();
+    std::cout << "DomainParticipant factory finalized at application exit"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -40,7 +40,6 @@ constexpr int ASYNC_WAITSET_THREADPOOL_SIZE = 5;
 const std::string APP_NAME = "Burst Publisher app";
 const int LOG_FREQUENCY = 100;
 const int ACKNOWLEDGMENT_TIMEOUT_MS = 5000;
-const int MICROSECONDS_PER_SECOND = 1000000;
 
 void burst_duration_statistics(
         const std::chrono::high_resolution_clock::time_point &start_time,
@@ -64,17 +63,6 @@ void burst_duration_statistics(
               << std::endl;
 }
 
-void sleep_until_next_sample(
-        std::chrono::high_resolution_clock::time_point &next_target_time,
-        const std::chrono::microseconds &sample_interval_us)
-{
-    auto now = std::chrono::high_resolution_clock::now();
-    next_target_time = next_target_time + sample_interval_us;
-    if (next_target_time > now) {
-        std::this_thread::sleep_until(next_target_time);
-    }
-}
-
 void run(
         std::shared_ptr<DDSParticipantSetup> participant_setup,
         unsigned int send_rate,
@@ -92,7 +80,7 @@ void run(
             DDSWriterSetup<example_types::FinalFlatPointCloud>>(
             participant_setup,
             topics::POINT_CLOUD_TOPIC,
-            qos_profiles::BURST_LARGE_DATA_UDP);
+            qos_profiles::PACED_BURST_LARGE_DATA_UDP);
 
     rti_logger.informational(
             "Burst publisher app is running. Press Ctrl+C to stop.");
@@ -111,19 +99,21 @@ void run(
     // NOTE: Using std::cout here for example clarity only. In production,
     // rti_logger.informational() is recommended for distributed logging.
     std::cout << "Starting burst of " << samples_to_send << " point clouds ("
-              << POINT_CLOUD_SIZE << " B) at " << send_rate
-              << " Hz. Bandwidth: "
-              << (send_rate * POINT_CLOUD_SIZE * 8 / 1000000) << " Mbps"
+              << POINT_CLOUD_SIZE
+              << " B). Wire pacing: BurstShaper flow controller"
               << std::endl;
 
     // Let's measure how long it takes to send these samples
     auto burst_start_time = std::chrono::high_resolution_clock::now();
 
-    // Calculate the interval between samples in microseconds with high
-    // precision (MICROSECONDS_PER_SECOND microseconds = 1 second)
-    auto sample_interval_us =
-            std::chrono::microseconds(MICROSECONDS_PER_SECOND / send_rate);
-    auto next_target_time = burst_start_time + sample_interval_us;
+    // The writer publishes asynchronously (PACED_BURST_LARGE_DATA_UDP):
+    // write() queues the sample and returns, and the BurstShaper flow
+    // controller drains the queue at the shaped rate on a middleware
+    // thread - no application-side sleep pacing, no scheduler jitter on
+    // the wire. The windowed-ack check bounds how far the queue runs
+    // ahead of acknowledgments (half the 200-sample send window), so
+    // sending overlaps ack collection instead of stop-and-wait.
+    const int64_t ACK_WINDOW = 100;
 
     while (!application::shutdown_requested
            && point_cloud_counter < samples_to_send) {
@@ -135,7 +125,8 @@ void run(
             // Set fields directly on the loaned sample
             root.point_cloud_id(point_cloud_counter);
 
-            // Write the loaned sample. This transfers ownership
+            // Write the loaned sample. This transfers ownership and only
+            // queues - the flow controller paces the actual send
             writer.write(*sample);
             if (point_cloud_counter % LOG_FREQUENCY == 0) {
                 rti_logger.informational(
@@ -150,9 +141,15 @@ void run(
                                      .c_str());
         }
 
-        // Sleep until next sample needs to be sent
-        if (point_cloud_counter < samples_to_send) {
-            sleep_until_next_sample(next_target_time, sample_interval_us);
+        // Block only while more than ACK_WINDOW samples are in flight
+        if (!burst_writer->wait_for_ack_window(
+                    ACK_WINDOW,
+                    ACKNOWLEDGMENT_TIMEOUT_MS)) {
+            rti_logger.warning(
+                    ("Ack window not reached after "
+                     + std::to_string(ACKNOWLEDGMENT_TIMEOUT_MS) + " ms at ID "
+                     + std::to_string(point_cloud_counter))
+                            .c_str());
         }
     }
 
@@ -190,12 +187,20 @@ int main(int argc, char *argv[])
         // 2. Sets up the AsyncWaitSet with a configurable thread pool
         // 3. Loads QoS profiles from the XML file and stores for
         // readers/writers
+        // Declare the workload so the transports are sized for it: the
+        // kernel socket buffer ceiling is checked at construction and
+        // reported loudly if it cannot absorb these bursts
+        TransportWorkloadHint workload(
+                example_types::MAX_POINT_CLOUD_SIZE,
+                static_cast<int>(arguments.send_rate));
+
         auto participant_setup = std::make_shared<DDSParticipantSetup>(
                 arguments.domain_id,
                 ASYNC_WAITSET_THREADPOOL_SIZE,
                 arguments.qos_file_path,
-                qos_profiles::LARGE_DATA_UDP_PARTICIPANT,
-                APP_NAME);
+                qos_profiles::PACED_BURST_PARTICIPANT,
+                APP_NAME,
+                workload);
 
         // Setup Distributed Logger Singleton
         // This publishes the RTI logs over DDS the network, enabling
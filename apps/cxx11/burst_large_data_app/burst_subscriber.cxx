@@ -29,8 +29,10 @@
 #include "application.hpp"  // for command line parsing and ctrl-c
 #include "ExampleTypes.hpp"
 #include "Definitions.hpp"
+#include "DDSAsyncLogger.hpp"
 #include "DDSParticipantSetup.hpp"
 #include "DDSReaderSetup.hpp"
+#include "DDSSpscRing.hpp"
 
 // For example legibility.
 using namespace rti::all;
@@ -40,33 +42,36 @@ constexpr int ASYNC_WAITSET_THREADPOOL_SIZE = 5;
 const std::string APP_NAME = "Burst Subscriber app";
 const int LOG_FREQUENCY = 100;
 const int MAIN_LOOP_SLEEP_MS = 500;
-
-void process_data(
-        dds::sub::DataReader<example_types::FinalFlatPointCloud> &reader)
+const int HANDOFF_RING_CAPACITY = 64;
+const int CONSUMER_POP_TIMEOUT_MS = 100;
+
+// A whole loaned batch is the unit of handoff between the AsyncWaitSet
+// callback (producer) and the application consumer thread. Moving the
+// LoanedSamples keeps the loans alive until the consumer is done with them.
+using PointCloudBatch =
+        rti::sub::LoanedSamples<example_types::FinalFlatPointCloud>;
+
+// Consumer-thread processing: runs on the application thread, decoupled
+// from DDS dispatch, so a processing hiccup here cannot back up into the
+// middleware receive queue
+void process_batch(PointCloudBatch &batch, unsigned long &samples_received)
 {
-    static unsigned long samples_received = 0;
-    try {
-        auto samples = reader.take();
-        for (const auto &sample : samples) {
-            // Check if message is not DDS metadata
-            if (sample.info().valid()) {
-                samples_received++;
-                if (samples_received % LOG_FREQUENCY == 0) {
-                    // NOTE: Using std::cout here for example clarity only. In
-                    // production, rti_logger.informational() is recommended for
-                    // distributed logging.
-                    std::cout << "Samples received: " << samples_received
-                              << ", size: "
-                              << sample.data().root().data().element_count()
-                              << " B" << std::endl;
-                }
+    for (const auto &sample : batch) {
+        // Check if message is not DDS metadata
+        if (sample.info().valid()) {
+            samples_received++;
+            if (samples_received % LOG_FREQUENCY == 0) {
+                // Progress line goes through the async logger: during a
+                // burst the consumer thread should be draining the ring,
+                // not blocked on the iostream lock
+                DDS_LOG_INFO(
+                        "Samples received: "
+                        + std::to_string(samples_received) + ", size: "
+                        + std::to_string(
+                                sample.data().root().data().element_count())
+                        + " B");
             }
         }
-    } catch (const std::exception &ex) {
-        rti::config::Logger::instance().error(
-                (std::string("Failed to process data: ")
-                 + std::string(ex.what()))
-                        .c_str());
     }
 }
 
@@ -86,8 +91,42 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
             topics::POINT_CLOUD_TOPIC,
             qos_profiles::BURST_LARGE_DATA_UDP);
 
-    // Enable Asynchronous Event-Driven processing for reader
-    burst_reader->set_data_available_handler(process_data);
+    // Handoff stage: the AsyncWaitSet callback only moves the loaned batch
+    // into the lock-free ring and returns, keeping DDS dispatch fast. The
+    // consumer thread below does the actual processing.
+    DDSSpscRing<PointCloudBatch> handoff_ring(HANDOFF_RING_CAPACITY);
+
+    burst_reader->set_loaned_batch_handler(
+            [&handoff_ring](PointCloudBatch &samples) {
+                if (!handoff_ring.try_push(std::move(samples))) {
+                    // Ring full: the batch is released here (loans returned)
+                    // and counted so back-pressure is visible
+                    std::cout << "Handoff ring full, batches dropped: "
+                              << handoff_ring.dropped_count() << std::endl;
+                }
+            });
+
+    // Consumer thread: pops batches and processes them at application pace
+    std::thread consumer_thread([&handoff_ring, &rti_logger]() {
+        unsigned long samples_received = 0;
+        PointCloudBatch batch;
+        while (!application::shutdown_requested) {
+            if (handoff_ring.pop_wait(
+                        batch,
+                        std::chrono::milliseconds(CONSUMER_POP_TIMEOUT_MS))) {
+                try {
+                    process_batch(batch, samples_received);
+                    // Release the loans before waiting for the next batch
+                    batch = PointCloudBatch();
+                } catch (const std::exception &ex) {
+                    rti_logger.error(
+                            (std::string("Failed to process data: ")
+                             + std::string(ex.what()))
+                                    .c_str());
+                }
+            }
+        }
+    });
 
     // Attach a handler for Sample Lost DDS event
     burst_reader->set_sample_lost_handler(
@@ -110,6 +149,8 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
                 std::chrono::milliseconds(MAIN_LOOP_SLEEP_MS));
     }
 
+    consumer_thread.join();
+
     rti_logger.informational("Burst subscriber application shutting down...");
 }
 
@@ -69,9 +69,12 @@ std::string command_type_to_string(example_types::CommandType cmd_type)
     }
 }
 
-void process_command_data(dds::sub::DataReader<example_types::Command> reader)
+// Per-instance handler for the COMMAND_CTRL instance: the wrapper's
+// instance dispatch hands over only this instance's samples, so there is no
+// key branching here
+void process_ctrl_command_batch(
+        rti::sub::LoanedSamples<example_types::Command> &samples)
 {
-    auto samples = reader.take();
     for (const auto &sample : samples) {
         // Check if message is not DDS metadata
         if (sample.info().valid()) {
@@ -139,8 +142,22 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
                     topics::COMMAND_TOPIC,
                     qos_profiles::COMMAND_STRENGTH_30);
 
-    // Enable Asynchronous Event-Driven processing for command reader
-    command_reader->set_data_available_handler(process_command_data);
+    // Enable instance-aware dispatch: samples are routed per instance by
+    // handle through the wrapper's hash index, and the COMMAND_CTRL
+    // instance goes straight to its registered handler. Commands on any
+    // other instance land in the default handler below.
+    command_reader->set_instance_dispatch_handler(
+            [](rti::sub::LoanedSamples<example_types::Command> &samples) {
+                std::cout << "Received " << samples.length()
+                          << " command(s) on an unregistered instance"
+                          << std::endl;
+            });
+
+    example_types::Command ctrl_key;
+    ctrl_key.command_id("COMMAND_CTRL");
+    command_reader->register_instance_handler(
+            ctrl_key,
+            process_ctrl_command_batch);
 
     rti_logger.notice("Command Override app is running. Press Ctrl+C to stop.");
     rti_logger.notice("Subscribing to Command messages...");
@@ -0,0 +1,334 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+/*
+ * datamodel_bench - serialization microbenchmarks for the IDL data model
+ *
+ * There was no way to measure the serialization cost of a type change; one
+ * unbounded member added to a type doubled publish CPU before anyone
+ * noticed. This target times XCDR serialize/deserialize for the data-model
+ * types across realistic payload sizes, plus FlatData loan/populate cycles,
+ * so an IDL change comes with before/after numbers:
+ *
+ *   ./datamodel_bench               # all benchmarks
+ *   ./datamodel_bench --no-flat     # skip the loan benchmarks (no DDS
+ *                                   # entities created)
+ *
+ * The harness is self-contained (google-benchmark style reporting, no
+ * external dependency): each benchmark is calibrated to ~100 ms per
+ * repetition, run 5 times, and the median ns/op is reported together with
+ * the payload throughput.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// include both the standard APIs and extensions
+#include <rti/rti.hpp>
+#include <rti/config/Logger.hpp>
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "ExampleTypes.hpp"
+#include "PointCloud.hpp"
+#include "RawImage.hpp"
+#include "Definitions.hpp"
+#include "DDSParticipantSetup.hpp"
+#include "DDSWriterSetup.hpp"
+
+// For example legibility.
+using namespace rti::all;
+
+const std::string APP_NAME = "Datamodel Bench";
+constexpr int REPETITIONS = 5;
+constexpr double TARGET_REP_SECONDS = 0.1;
+
+// ---------------------------------------------------------------------------
+// Harness
+// ---------------------------------------------------------------------------
+
+// Run `body` in a calibrated loop REPETITIONS times and report the median
+// ns/op plus MB/s over payload_bytes. Calibration targets ~100 ms per
+// repetition so fast bodies still accumulate a stable sample count.
+template <typename Body>
+void benchmark(const std::string &name, size_t payload_bytes, Body &&body)
+{
+    using clock = std::chrono::steady_clock;
+
+    // Warm up (first iterations pay cache/page faults we don't want timed)
+    for (int i = 0; i < 16; i++) {
+        body();
+    }
+
+    // Calibrate: how many iterations fill the target repetition time
+    uint64_t iterations = 1;
+    for (;;) {
+        const auto start = clock::now();
+        for (uint64_t i = 0; i < iterations; i++) {
+            body();
+        }
+        const double elapsed =
+                std::chrono::duration<double>(clock::now() - start).count();
+        if (elapsed >= TARGET_REP_SECONDS || iterations >= (1ull << 24)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    // Measure
+    std::vector<double> ns_per_op;
+    ns_per_op.reserve(REPETITIONS);
+    for (int rep = 0; rep < REPETITIONS; rep++) {
+        const auto start = clock::now();
+        for (uint64_t i = 0; i < iterations; i++) {
+            body();
+        }
+        const double elapsed =
+                std::chrono::duration<double>(clock::now() - start).count();
+        ns_per_op.push_back(elapsed * 1e9 / iterations);
+    }
+    std::sort(ns_per_op.begin(), ns_per_op.end());
+    const double median = ns_per_op[REPETITIONS / 2];
+
+    std::cout << std::left << std::setw(44) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(0) << median
+              << " ns/op" << std::setw(12) << iterations << " iters";
+    if (payload_bytes > 0) {
+        std::cout << std::setw(10) << std::setprecision(1)
+                  << (payload_bytes * 1e3 / median) << " MB/s";
+    }
+    std::cout << std::endl;
+}
+
+// ---------------------------------------------------------------------------
+// Sample builders (realistic payloads)
+// ---------------------------------------------------------------------------
+
+::foxglove::RawImage make_raw_image(uint32_t width, uint32_t height,
+        uint32_t bytes_per_pixel, const std::string &encoding)
+{
+    ::foxglove::RawImage image;
+    image.timestamp().sec(1700000000);
+    image.timestamp().nsec(500000000);
+    image.frame_id("camera_front");
+    image.width(width);
+    image.height(height);
+    image.encoding(encoding);
+    image.step(width * bytes_per_pixel);
+    std::vector<uint8_t> pixels(
+            static_cast<size_t>(width) * height * bytes_per_pixel);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        pixels[i] = static_cast<uint8_t>(i % 256);
+    }
+    image.data(std::move(pixels));
+    return image;
+}
+
+::foxglove::PointCloud make_point_cloud(size_t data_bytes)
+{
+    ::foxglove::PointCloud cloud;
+    cloud.timestamp().sec(1700000000);
+    cloud.timestamp().nsec(500000000);
+    cloud.frame_id("lidar_top");
+    cloud.point_stride(16);
+
+    std::vector<::foxglove::PackedElementField> fields(4);
+    const char *names[] = { "x", "y", "z", "intensity" };
+    for (size_t i = 0; i < fields.size(); i++) {
+        fields[i].name(names[i]);
+        fields[i].offset(static_cast<uint32_t>(i * 4));
+        fields[i].type(::foxglove::NumericType::FLOAT32);
+    }
+    cloud.fields(fields);
+
+    std::vector<uint8_t> data(data_bytes);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i % 256);
+    }
+    cloud.data(std::move(data));
+    return cloud;
+}
+
+example_types::ParameterEvent make_parameter_event(size_t parameter_count)
+{
+    example_types::ParameterEvent event;
+    event.node_id("bench_node");
+    event.timestamp_ns(1700000000000000000ull);
+    std::vector<example_types::Parameter> parameters(parameter_count);
+    for (size_t i = 0; i < parameters.size(); i++) {
+        parameters[i].name("namespace.component.parameter_" + std::to_string(i));
+        parameters[i].value().string_value(
+                "value_" + std::to_string(i) + "_payload");
+    }
+    event.changed_parameters(parameters);
+    return event;
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark groups
+// ---------------------------------------------------------------------------
+
+// XCDR serialize + deserialize round trips through to_cdr_buffer /
+// from_cdr_buffer - the same code path the DataWriter/DataReader use
+template <typename T>
+void bench_xcdr(const std::string &name, const T &sample, size_t payload_bytes)
+{
+    std::vector<char> buffer;
+    dds::topic::topic_type_support<T>::to_cdr_buffer(buffer, sample);
+    const size_t serialized_size = buffer.size();
+
+    benchmark(name + "/serialize", payload_bytes, [&] {
+        dds::topic::topic_type_support<T>::to_cdr_buffer(buffer, sample);
+    });
+
+    T deserialized;
+    benchmark(name + "/deserialize", payload_bytes, [&] {
+        dds::topic::topic_type_support<T>::from_cdr_buffer(
+                deserialized,
+                buffer);
+    });
+
+    std::cout << std::left << std::setw(44)
+              << (name + "/serialized_size") << std::right << std::setw(12)
+              << serialized_size << " bytes" << std::endl;
+}
+
+// FlatData types skip serialization entirely - their cost is the loan
+// cycle and populating the sample in place. Measured against a real
+// writer so the loan pool behaves as in production.
+void bench_flat_loans(std::shared_ptr<DDSParticipantSetup> participant_setup)
+{
+    auto flat_writer = std::make_shared<
+            DDSWriterSetup<example_types::FinalFlatImage>>(
+            participant_setup,
+            topics::FINAL_FLAT_IMAGE_TOPIC,
+            qos_profiles::LARGE_DATA_SHMEM_ZC);
+    auto writer = flat_writer->writer();
+
+    // Warm the loan pool so the benchmarks measure reuse, not first-touch
+    flat_writer->reserve_loans(8);
+
+    uint32_t count = 0;
+    benchmark("FinalFlatImage/loan_metadata_discard", 0, [&] {
+        auto *sample = flat_writer->try_get_loan();
+        if (sample == nullptr) {
+            return;
+        }
+        auto root = sample->root();
+        root.image_id(count++);
+        root.width(640);
+        root.height(480);
+        root.format(0);
+        writer->discard_loan(*sample);
+    });
+
+    constexpr size_t POPULATE_BYTES = 65536;
+    benchmark("FinalFlatImage/loan_populate_64KB", POPULATE_BYTES, [&] {
+        auto *sample = flat_writer->try_get_loan();
+        if (sample == nullptr) {
+            return;
+        }
+        auto root = sample->root();
+        root.image_id(count++);
+        root.width(640);
+        root.height(480);
+        root.format(0);
+        auto data_array = root.data();
+        for (size_t i = 0; i < POPULATE_BYTES; i++) {
+            data_array.set_element(i, static_cast<uint8_t>(i % 256));
+        }
+        writer->discard_loan(*sample);
+    });
+}
+
+void run(const application::ApplicationArguments &arguments)
+{
+    std::cout << "Datamodel serialization benchmarks (median of "
+              << REPETITIONS << " repetitions)\n"
+              << std::string(88, '-') << std::endl;
+
+    // RawImage across realistic camera payloads
+    bench_xcdr("RawImage/mono8_320x240",
+            make_raw_image(320, 240, 1, "mono8"),
+            320 * 240);
+    bench_xcdr("RawImage/rgb8_640x480",
+            make_raw_image(640, 480, 3, "rgb8"),
+            640 * 480 * 3);
+    bench_xcdr("RawImage/rgb8_1024x1024",
+            make_raw_image(1024, 1024, 3, "rgb8"),
+            1024 * 1024 * 3);
+
+    // PointCloud at typical lidar scan sizes
+    bench_xcdr("PointCloud/64KB",
+            make_point_cloud(64 * 1024),
+            64 * 1024);
+    bench_xcdr("PointCloud/500KB",
+            make_point_cloud(500 * 1024),
+            500 * 1024);
+
+    // Parameter batches (Parameter itself is @nested, so the smallest
+    // serializable unit is the ParameterEvent that carries them)
+    bench_xcdr("ParameterEvent/8_params", make_parameter_event(8), 0);
+    bench_xcdr("ParameterEvent/64_params", make_parameter_event(64), 0);
+
+    if (arguments.skip_flat) {
+        std::cout << "FlatData loan benchmarks skipped (--no-flat)"
+                  << std::endl;
+        return;
+    }
+
+    // FlatData loan benchmarks need a participant with the large-data
+    // SHMEM transport sized for FinalFlatImage
+    auto participant_setup = std::make_shared<DDSParticipantSetup>(
+            arguments.domain_id,
+            1,
+            arguments.qos_file_path,
+            qos_profiles::LARGE_DATA_PARTICIPANT,
+            APP_NAME);
+    bench_flat_loans(participant_setup);
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    try {
+        rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+        // Run
+        run(arguments);
+
+    } catch (const std::exception &ex) {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Finalize participant factory after all DDS entities are cleaned up
+    dds::domain::DomainParticipant::finalize_participant_factory();
+    std::cout << "DomainParticipant factory finalized at application exit"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+/*
+ * dds_recorder - embedded black-box capture for camera + lidar topics
+ *
+ * The external Recording Service (services/start_record.sh) adds a
+ * process hop and per-sample database overhead that drops frames at
+ * 3 MB x 60 fps on an embedded SSD. This app records in-process: each
+ * topic's loaned-batch handler serializes the sample to CDR in a reused
+ * buffer and hands it to DDSSegmentRecorder, whose write path is one
+ * memcpy into a preallocated memory-mapped segment ring (see
+ * DDSSegmentRecorder.hpp for the on-disk format).
+ *
+ * Channels in the segment index:
+ *   0 = PointCloud topic (foxglove::PointCloud)
+ *   1 = Image topic (foxglove::RawImage)
+ *
+ * A once-per-second report prints sample/byte rates and the drop
+ * counter, which is the number to watch when validating an SSD.
+ */
+
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// include both the standard APIs and extensions
+#include <rti/rti.hpp>
+#include <rti/config/Logger.hpp>
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "PointCloud.hpp"
+#include "RawImage.hpp"
+#include "Definitions.hpp"
+#include "DDSParticipantSetup.hpp"
+#include "DDSReaderSetup.hpp"
+#include "DDSSegmentRecorder.hpp"
+
+// For example legibility.
+using namespace rti::all;
+
+const std::string APP_NAME = "DDS Recorder";
+constexpr uint32_t POINT_CLOUD_CHANNEL = 0;
+constexpr uint32_t IMAGE_CHANNEL = 1;
+
+uint64_t wall_clock_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+}
+
+// Serialize each valid sample in the batch into a reused CDR buffer and
+// append it to the recorder. The recorder's write path is not locked, so
+// the two topic handlers (which run on AsyncWaitSet pool threads)
+// serialize first and only hold the mutex for the memcpy+index append.
+template <typename T>
+void record_batch(
+        dds::sub::LoanedSamples<T> &samples,
+        DDSSegmentRecorder &recorder,
+        std::mutex &recorder_mutex,
+        uint32_t channel_id,
+        std::vector<char> &cdr_buffer)
+{
+    for (const auto &sample : samples) {
+        if (!sample.info().valid()) {
+            continue;
+        }
+        dds::topic::topic_type_support<T>::to_cdr_buffer(
+                cdr_buffer,
+                sample.data());
+
+        std::lock_guard<std::mutex> lock(recorder_mutex);
+        recorder.record(
+                wall_clock_ns(),
+                channel_id,
+                cdr_buffer.data(),
+                cdr_buffer.size());
+    }
+}
+
+void run(const application::ApplicationArguments &arguments)
+{
+    DDSSegmentRecorder recorder(
+            arguments.output_directory,
+            static_cast<size_t>(arguments.segment_mb) * 1024 * 1024,
+            arguments.segment_count);
+    if (!recorder.start()) {
+        throw std::runtime_error("recorder storage setup failed");
+    }
+    std::mutex recorder_mutex;
+
+    auto participant_setup = std::make_shared<DDSParticipantSetup>(
+            arguments.domain_id,
+            2,
+            arguments.qos_file_path,
+            qos_profiles::LARGE_DATA_PARTICIPANT,
+            APP_NAME);
+
+    // One reader + reused CDR buffer per recorded topic; each runs on its
+    // own AsyncWaitSet lane so a slow serialize on camera frames cannot
+    // delay lidar takes
+    auto point_cloud_reader =
+            std::make_shared<DDSReaderSetup<::foxglove::PointCloud>>(
+                    participant_setup,
+                    topics::POINT_CLOUD_TOPIC,
+                    qos_profiles::LARGE_DATA_SHMEM,
+                    "lidar");
+    std::vector<char> point_cloud_cdr;
+    point_cloud_cdr.reserve(1024 * 1024);
+    point_cloud_reader->set_loaned_batch_handler(
+            [&](dds::sub::LoanedSamples<::foxglove::PointCloud> &samples) {
+                record_batch(
+                        samples,
+                        recorder,
+                        recorder_mutex,
+                        POINT_CLOUD_CHANNEL,
+                        point_cloud_cdr);
+            });
+
+    auto image_reader = std::make_shared<DDSReaderSetup<::foxglove::RawImage>>(
+            participant_setup,
+            topics::IMAGE_TOPIC,
+            qos_profiles::LARGE_DATA_SHMEM,
+            "camera");
+    std::vector<char> image_cdr;
+    image_cdr.reserve(4 * 1024 * 1024);
+    image_reader->set_loaned_batch_handler(
+            [&](dds::sub::LoanedSamples<::foxglove::RawImage> &samples) {
+                record_batch(
+                        samples,
+                        recorder,
+                        recorder_mutex,
+                        IMAGE_CHANNEL,
+                        image_cdr);
+            });
+
+    // Once-per-second report: rates plus the drop counter
+    uint64_t last_samples = 0;
+    uint64_t last_bytes = 0;
+    while (!application::shutdown_requested) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const uint64_t samples = recorder.recorded_samples();
+        const uint64_t bytes = recorder.bytes_written();
+        std::cout << "recorded " << (samples - last_samples) << " samples/s, "
+                  << ((bytes - last_bytes) / (1024 * 1024)) << " MB/s, "
+                  << recorder.dropped_samples() << " dropped total"
+                  << std::endl;
+        last_samples = samples;
+        last_bytes = bytes;
+    }
+
+    recorder.stop();
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    try {
+        rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+        // Run
+        run(arguments);
+
+    } catch (const std::exception &ex) {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Finalize participant factory after all DDS entities are cleaned up
+    dds::domain::DomainParticipant::finalize_participant_factory();
+    std::cout << "DomainParticipant factory finalized at application exit"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,221 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+/*
+ * dds_replayer - faster-than-realtime replay of dds_recorder segments
+ *
+ * Companion to dds_recorder: memory-maps a recorded segment ring (see
+ * DDSSegmentRecorder.hpp for the format) and republishes the samples
+ * through DDSWriterSetup with a configurable time-scale factor. The
+ * Replay Service caps at roughly realtime; replaying a nightly 6-hour
+ * soak at -s 20 compresses it into ~20 minutes, and -s 0 goes as fast
+ * as subscribers acknowledge (paced by the reliable ack window, not a
+ * clock).
+ *
+ * The recorded capture time is preserved as each write's DDS source
+ * timestamp, so subscriber-side logic keyed on source timestamps sees
+ * original time even under compression; payloads (including their
+ * in-band timestamp fields) are republished unmodified. File readahead
+ * runs on DDSSegmentReplayer's background thread, keeping page faults
+ * out of the publish loop.
+ */
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// include both the standard APIs and extensions
+#include <rti/rti.hpp>
+#include <rti/config/Logger.hpp>
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "PointCloud.hpp"
+#include "RawImage.hpp"
+#include "Definitions.hpp"
+#include "DDSParticipantSetup.hpp"
+#include "DDSWriterSetup.hpp"
+#include "DDSSegmentReplayer.hpp"
+
+// For example legibility.
+using namespace rti::all;
+
+const std::string APP_NAME = "DDS Replayer";
+
+// Channel ids assigned by dds_recorder
+constexpr uint32_t POINT_CLOUD_CHANNEL = 0;
+constexpr uint32_t IMAGE_CHANNEL = 1;
+
+// Outstanding-sample window for -s 0 (ack-paced) replay
+constexpr int64_t ACK_WINDOW = 64;
+constexpr int ACK_TIMEOUT_MS = 10000;
+
+// Deserialize the recorded CDR payload and publish it with the capture
+// time as the DDS source timestamp
+template <typename T>
+void publish_record(
+        std::shared_ptr<DDSWriterSetup<T>> writer_setup,
+        const DDSSegmentReplayer::Record &record,
+        std::vector<char> &cdr_buffer,
+        T &sample)
+{
+    cdr_buffer.assign(
+            reinterpret_cast<const char *>(record.payload),
+            reinterpret_cast<const char *>(record.payload)
+                    + record.entry->length);
+    dds::topic::topic_type_support<T>::from_cdr_buffer(sample, cdr_buffer);
+
+    writer_setup->writer().write(
+            sample,
+            dds::core::Time(
+                    static_cast<int32_t>(
+                            record.entry->timestamp_ns / 1000000000ull),
+                    static_cast<uint32_t>(
+                            record.entry->timestamp_ns % 1000000000ull)));
+}
+
+void run(const application::ApplicationArguments &arguments)
+{
+    DDSSegmentReplayer replayer(arguments.input_directory);
+    if (!replayer.open()) {
+        throw std::runtime_error("no replayable recording found");
+    }
+    replayer.start_readahead();
+
+    auto participant_setup = std::make_shared<DDSParticipantSetup>(
+            arguments.domain_id,
+            2,
+            arguments.qos_file_path,
+            qos_profiles::LARGE_DATA_PARTICIPANT,
+            APP_NAME);
+
+    auto point_cloud_writer =
+            std::make_shared<DDSWriterSetup<::foxglove::PointCloud>>(
+                    participant_setup,
+                    topics::POINT_CLOUD_TOPIC,
+                    qos_profiles::LARGE_DATA_SHMEM);
+    auto image_writer = std::make_shared<DDSWriterSetup<::foxglove::RawImage>>(
+            participant_setup,
+            topics::IMAGE_TOPIC,
+            qos_profiles::LARGE_DATA_SHMEM);
+
+    // Reused deserialization state per channel
+    std::vector<char> cdr_buffer;
+    cdr_buffer.reserve(4 * 1024 * 1024);
+    ::foxglove::PointCloud point_cloud_sample;
+    ::foxglove::RawImage image_sample;
+
+    const bool ack_paced = arguments.time_scale <= 0.0;
+    std::cout << "Replaying " << replayer.record_count() << " records at "
+              << (ack_paced ? std::string("ack-paced speed")
+                            : std::to_string(arguments.time_scale) + "x")
+              << std::endl;
+
+    using clock = std::chrono::steady_clock;
+    const auto replay_start = clock::now();
+    const uint64_t capture_start = replayer.record(0).entry->timestamp_ns;
+
+    uint64_t published = 0;
+    uint64_t skipped = 0;
+    for (size_t i = 0;
+            i < replayer.record_count() && !application::shutdown_requested;
+            i++) {
+        const auto &record = replayer.record(i);
+        replayer.advance_cursor(i);
+
+        if (!ack_paced) {
+            // Compress the capture timeline by the scale factor and
+            // sleep until this record's slot
+            const auto offset = std::chrono::nanoseconds(static_cast<int64_t>(
+                    (record.entry->timestamp_ns - capture_start)
+                    / arguments.time_scale));
+            std::this_thread::sleep_until(replay_start + offset);
+        }
+
+        switch (record.entry->channel_id) {
+        case POINT_CLOUD_CHANNEL:
+            publish_record(
+                    point_cloud_writer,
+                    record,
+                    cdr_buffer,
+                    point_cloud_sample);
+            if (ack_paced
+                    && !point_cloud_writer->wait_for_ack_window(
+                            ACK_WINDOW,
+                            ACK_TIMEOUT_MS)) {
+                std::cerr << "ack window timeout on PointCloud; subscribers "
+                             "are not keeping up" << std::endl;
+            }
+            published++;
+            break;
+        case IMAGE_CHANNEL:
+            publish_record(image_writer, record, cdr_buffer, image_sample);
+            if (ack_paced
+                    && !image_writer->wait_for_ack_window(
+                            ACK_WINDOW,
+                            ACK_TIMEOUT_MS)) {
+                std::cerr << "ack window timeout on Image; subscribers are "
+                             "not keeping up" << std::endl;
+            }
+            published++;
+            break;
+        default:
+            skipped++;
+            break;
+        }
+    }
+
+    // Drain reliable queues before tearing the writers down
+    point_cloud_writer->writer().wait_for_acknowledgments(
+            dds::core::Duration::from_secs(10));
+    image_writer->writer().wait_for_acknowledgments(
+            dds::core::Duration::from_secs(10));
+
+    const double elapsed = std::chrono::duration<double>(
+            clock::now() - replay_start).count();
+    std::cout << "Replayed " << published << " records in " << elapsed
+              << " s (" << skipped << " skipped: unknown channel)"
+              << std::endl;
+
+    replayer.close();
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    try {
+        rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+        // Run
+        run(arguments);
+
+    } catch (const std::exception &ex) {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Finalize participant factory after all DDS entities are cleaned up
+    dds::domain::DomainParticipant::finalize_participant_factory();
+    std::cout << "DomainParticipant factory finalized at application exit"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -33,6 +33,7 @@
 #include "application.hpp"  // for command line parsing and ctrl-c
 #include "ExampleTypes.hpp"
 #include "Definitions.hpp"
+#include "DDSGeoJsonBuilder.hpp"
 #include "DDSParticipantSetup.hpp"
 #include "DDSReaderSetup.hpp"
 #include "DDSWriterSetup.hpp"
@@ -172,8 +173,20 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
     rti_logger.notice("Publishing Position messages...");
 
 
+    // Sample object reused across iterations. The builder assembles the
+    // track polyline in one preallocated buffer: each cycle appends only
+    // the new coordinate and the unchanged prefix is never re-serialized,
+    // and the buffer moves in and out of the sample with no copy.
     ::foxglove::GeoJSON pos_msg;
 
+    constexpr size_t GEOJSON_BUFFER_SIZE = 64 * 1024;
+    DDSGeoJsonBuilder geojson_builder(GEOJSON_BUFFER_SIZE);
+    geojson_builder.begin_line_string("Alhambra Track");
+
+    // Simulated track starting point
+    double longitude = -122.4194;
+    double latitude = 37.7749;
+
     // Counter for tracking iterations
     int iteration = 0;
 
@@ -181,25 +194,26 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
 
       try
       {
-        // Populate and send position message
-        std::string json_string = R"({
-  "type": "FeatureCollection",
-  "features": [
-    {
-      "type": "Feature",
-      "geometry": {
-        "type": "Point",
-        "coordinates": [-122.4194, 37.7749]
-      },
-      "properties": {
-        "name": "Alhambra"
-      }
-    }
-  ]
-})";        
-        pos_msg.geojson(json_string);
+        // Extend the polyline by this cycle's position and publish the
+        // whole track - one appended coordinate, zero allocations
+        geojson_builder.add_point(longitude, latitude);
+        geojson_builder.finalize();
+        longitude += 0.0005;
+        latitude += 0.0003;
+
+        pos_msg.geojson(geojson_builder.take());
         position_writer->writer().write(pos_msg);
 
+        // write() serializes synchronously - take the string storage back
+        // and reopen the document tail for the next coordinate
+        geojson_builder.reclaim(std::move(pos_msg.geojson()));
+        geojson_builder.reopen();
+
+        if (geojson_builder.overflowed()) {
+          rti_logger.warning("GeoJSON buffer full - restarting track");
+          geojson_builder.begin_line_string("Alhambra Track");
+        }
+
         // Log every position publish
         std::cout << "[POSITION]" << std::endl;
         
@@ -15,6 +15,7 @@
 #include <chrono>
 #include <atomic>
 #include <vector>
+#include <cstring>
 
 // include both the standard APIs and extensions
 #include <rti/rti.hpp>
@@ -127,6 +128,11 @@ public:
         
         // Connect callback for new samples
         g_signal_connect(appsink_, "new-sample", G_CALLBACK(on_new_sample_static), this);
+
+        // Fixed fields of the reused DDS sample are set once - only the
+        // timestamp and payload change per frame
+        video_msg_.frame_id("camera");
+        video_msg_.format("h264");
     }
     
     ~GStreamerVideoPublisher() {
@@ -224,23 +230,26 @@ private:
         }
         
         try {
-            // Create DDS sample
-            ::foxglove::CompressedVideo data;
-            data.frame_id("camera");
-            data.format("h264");
-            
             // Set timestamp
             ::foxglove::Time timestamp;
             timestamp.sec(static_cast<int32_t>(frame_count_ / fps_));
             timestamp.nsec((frame_count_ % fps_) * (1000000000 / fps_));
-            data.timestamp(timestamp);
-            
-            // Copy encoded data
-            std::vector<uint8_t> encoded_data(map.data, map.data + map.size);
-            data.data(encoded_data);
-            
+            video_msg_.timestamp(timestamp);
+
+            // Copy the access unit straight from the mapped GstBuffer into
+            // the reused sample's data sequence. The sequence keeps its
+            // capacity across frames, so after the first few frames this is
+            // a single memcpy with no per-frame allocation (previously the
+            // capture thread built a temporary vector and copied it again
+            // into a fresh sequence). The GstBuffer stays mapped until the
+            // synchronous write below returns, so the middleware serializes
+            // directly from stable memory.
+            auto& payload = video_msg_.data();
+            payload.resize(map.size);
+            std::memcpy(payload.data(), map.data, map.size);
+
             // Write to DDS
-            writer_setup_->writer().write(data);
+            writer_setup_->writer().write(video_msg_);
             
             std::cout << "Published frame " << frame_count_ 
                       << " (" << map.size << " bytes)" << std::endl;
@@ -259,6 +268,9 @@ private:
     }
     
     std::shared_ptr<DDSWriterSetup<::foxglove::CompressedVideo>> writer_setup_;
+    // Reused per-frame sample - the data sequence keeps its capacity so the
+    // capture thread never allocates in steady state
+    ::foxglove::CompressedVideo video_msg_;
     int width_;
     int height_;
     int fps_;
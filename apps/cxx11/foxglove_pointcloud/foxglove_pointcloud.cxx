@@ -36,6 +36,7 @@
 #include "DDSParticipantSetup.hpp"
 #include "DDSReaderSetup.hpp"
 #include "DDSWriterSetup.hpp"
+#include "DDSPointPacking.hpp"
 #include "PointCloud.hpp"
 #include "FrameTransforms.hpp"
 
@@ -53,11 +54,6 @@ constexpr uint32_t IMAGE_SIZE = IMAGE_WIDTH * IMAGE_HEIGHT * 3;  // RGB format
                                                                  // (~900 KB)
 
 
-// Write a little-endian float into buf at byte offset
-static void pack_float32(std::vector<uint8_t>& buf, size_t offset, float value)
-{
-    std::memcpy(buf.data() + offset, &value, sizeof(float));
-}
 
 void process_pointcloud_data(dds::sub::DataReader<::foxglove::PointCloud> reader)
 {
@@ -187,6 +183,15 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
     cloud.fields(fields);
     uint32_t samples_written = 0;
 
+    // SoA channel buffers reused across frames, consumed by the packing
+    // kernel below
+    std::vector<float> xs(NUM_POINTS);
+    std::vector<float> ys(NUM_POINTS);
+    std::vector<float> zs(NUM_POINTS);
+
+    std::cout << "Point packing kernel: " << point_packing::instruction_set()
+              << std::endl;
+
     while (!application::shutdown_requested) {
         try {
             // Timestamp derived from wall-clock sample index at 10 Hz
@@ -198,8 +203,10 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
         // Rotate the sphere slightly each frame for a live animation effect
         const float angle_offset = samples_written * 0.05f;
 
-        std::vector<uint8_t> data(static_cast<size_t>(NUM_POINTS) * POINT_STRIDE);
-
+        // Generate the channels structure-of-arrays, then interleave them
+        // into the PackedElementField layout with the vectorized packing
+        // kernel in one pass (SSE/NEON when the build targets them, scalar
+        // otherwise)
         int point_idx = 0;
         for (int lat = 0; lat < LAT_STEPS; ++lat) {
             // phi: 0 (north pole) → π (south pole)
@@ -209,19 +216,18 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
                 float theta = 2.0f * static_cast<float>(M_PI) * lon / LON_STEPS
                               + angle_offset;
 
-                float x = RADIUS * std::sin(phi) * std::cos(theta);
-                float y = RADIUS * std::sin(phi) * std::sin(theta);
-                float z = RADIUS * std::cos(phi);
-
-                size_t byte_offset = static_cast<size_t>(point_idx) * POINT_STRIDE;
-                pack_float32(data, byte_offset,     x);
-                pack_float32(data, byte_offset + 4, y);
-                pack_float32(data, byte_offset + 8, z);
+                xs[point_idx] = RADIUS * std::sin(phi) * std::cos(theta);
+                ys[point_idx] = RADIUS * std::sin(phi) * std::sin(theta);
+                zs[point_idx] = RADIUS * std::cos(phi);
 
                 ++point_idx;
             }
         }
 
+        std::vector<uint8_t> data(static_cast<size_t>(NUM_POINTS) * POINT_STRIDE);
+        point_packing::pack_xyz(
+                xs.data(), ys.data(), zs.data(), NUM_POINTS, data.data());
+
         cloud.data(data);
 
         // Publish the identity transform with the same timestamp so the 3D
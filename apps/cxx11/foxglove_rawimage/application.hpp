@@ -47,16 +47,19 @@ namespace application {
         unsigned int domain_id;
         rti::config::Verbosity verbosity;
         std::string qos_file_path;
+        bool zero_copy;
 
         ApplicationArguments(
             ParseReturn parse_result_param,
             unsigned int domain_id_param,
             rti::config::Verbosity verbosity_param,
-            const std::string& qos_file_path_param)
+            const std::string& qos_file_path_param,
+            bool zero_copy_param)
             : parse_result(parse_result_param),
             domain_id(domain_id_param),
             verbosity(verbosity_param),
-            qos_file_path(qos_file_path_param) {}
+            qos_file_path(qos_file_path_param),
+            zero_copy(zero_copy_param) {}
     };
 
     inline void set_verbosity(
@@ -104,6 +107,7 @@ namespace application {
         unsigned int domain_id = domains::DEFAULT_DOMAIN_ID;
         rti::config::Verbosity verbosity(rti::config::Verbosity::EXCEPTION);
         std::string qos_file_path = "dds/qos/DDS_QOS_PROFILES.xml"; // Default QoS file
+        bool zero_copy = false;
 
         while (arg_processing < argc) {
             if ((argc > arg_processing + 1) 
@@ -121,9 +125,13 @@ namespace application {
             || strcmp(argv[arg_processing], "--qos-file") == 0)) {
                 qos_file_path = argv[arg_processing + 1];
                 arg_processing += 2;
+            } else if (strcmp(argv[arg_processing], "-z") == 0
+            || strcmp(argv[arg_processing], "--zero-copy") == 0) {
+                zero_copy = true;
+                arg_processing += 1;
             } else if (strcmp(argv[arg_processing], "-h") == 0
             || strcmp(argv[arg_processing], "--help") == 0) {
-                std::cout << "Example I/O application with Command, Button, Config inputs and Position outputs." << std::endl;
+                std::cout << "Foxglove RawImage application. Use --zero-copy to publish the FlatData/SHMEM_REF FlatRawImage variant via writer loans." << std::endl;
                 show_usage = true;
                 parse_result = ParseReturn::exit;
                 break;
@@ -143,11 +151,13 @@ namespace application {
             "                               Range: 0-5 \n"
             "                               Default: 1\n"
             "    -q, --qos-file     <str>   Path to QoS profile XML file.\n"\
-            "                               Default: dds/qos/DDS_QOS_PROFILES.xml"
+            "                               Default: dds/qos/DDS_QOS_PROFILES.xml\n"\
+            "    -z, --zero-copy            Publish foxglove::FlatRawImage via\n"\
+            "                               writer loans (FlatData + SHMEM_REF)"
             << std::endl;
         }
 
-        return ApplicationArguments(parse_result, domain_id, verbosity, qos_file_path);
+        return ApplicationArguments(parse_result, domain_id, verbosity, qos_file_path, zero_copy);
     }
 
 }  // namespace application
@@ -31,10 +31,12 @@
 #include "application.hpp"  // for command line parsing and ctrl-c
 #include "ExampleTypes.hpp"
 #include "Definitions.hpp"
+#include "DDSBufferPool.hpp"
 #include "DDSParticipantSetup.hpp"
 #include "DDSReaderSetup.hpp"
 #include "DDSWriterSetup.hpp"
 #include "RawImage.hpp"
+#include "FlatSensorTypes.hpp"
 
 // For example legibility.
 using namespace rti::all;
@@ -49,6 +51,14 @@ constexpr uint32_t IMAGE_HEIGHT = 480;
 constexpr uint32_t IMAGE_SIZE = IMAGE_WIDTH * IMAGE_HEIGHT * 3;  // RGB format
                                                                  // (~900 KB)
 
+// Writer loans warmed up front for the zero-copy path so no frame pays the
+// shared-memory allocation cost
+constexpr int LOAN_POOL_DEPTH = 8;
+
+// Pixel buffers preallocated for the XCDR path - the buffer storage cycles
+// between pool and sample by move, so steady state does zero allocations
+constexpr size_t BUFFER_POOL_DEPTH = 4;
+
 
 void process_image_data(dds::sub::DataReader<::foxglove::RawImage> reader)
 {
@@ -74,6 +84,130 @@ void process_image_data(dds::sub::DataReader<::foxglove::RawImage> reader)
 }
 
 
+void process_flat_image_data(
+        dds::sub::DataReader<::foxglove::FlatRawImage> reader)
+{
+    auto samples = reader.take();
+    for (const auto &sample : samples) {
+        // Check if message is not DDS metadata
+        if (sample.info().valid()) {
+            // FlatData types are accessed through .root()
+            auto root = sample.data().root();
+
+            std::cout << "[IMAGE_SUBSCRIBER] FlatRawImage Received:" << std::endl;
+            std::cout << "  Frame number: " << root.frame_number() << std::endl;
+            std::cout << "  Width: " << root.width() << std::endl;
+            std::cout << "  Height: " << root.height() << std::endl;
+            std::cout << "  Encoding code: " << root.encoding() << std::endl;
+            std::cout << "  Data Size: " << root.data_length() << " bytes"
+                      << std::endl;
+
+            // overloaded -> operator to use RTI extension
+            std::cout << "  Topic: " << reader->topic_name() << std::endl;
+        }
+    }
+}
+
+// Zero-copy variant: publishes ::foxglove::FlatRawImage through writer loans
+// (@final FlatData + SHMEM_REF), so the pixel buffer is produced directly in
+// the shared-memory sample - no per-frame std::vector and no serialization
+// copy into the sample
+void run_zero_copy(std::shared_ptr<DDSParticipantSetup> participant_setup)
+{
+    auto &rti_logger = rti::config::Logger::instance();
+
+    rti_logger.notice("Large Data application starting (zero-copy)...");
+
+    // Setup Reader Interface with LARGE_DATA_SHMEM_ZC QoS
+    auto image_reader =
+            std::make_shared<DDSReaderSetup<::foxglove::FlatRawImage>>(
+                    participant_setup,
+                    topics::FLAT_IMAGE_TOPIC,
+                    qos_profiles::LARGE_DATA_SHMEM_ZC);
+
+    // Setup Writer Interface with LARGE_DATA_SHMEM_ZC QoS
+    auto image_writer =
+            std::make_shared<DDSWriterSetup<::foxglove::FlatRawImage>>(
+                    participant_setup,
+                    topics::FLAT_IMAGE_TOPIC,
+                    qos_profiles::LARGE_DATA_SHMEM_ZC);
+
+    // Enable Asynchronous Event-Driven processing for reader
+    image_reader->set_data_available_handler(process_flat_image_data);
+
+    // Warm the writer loan pool so no frame in the publish loop pays the
+    // shared-memory allocation cost
+    image_writer->reserve_loans(LOAN_POOL_DEPTH);
+
+    rti_logger.notice("Large Data app is running. Press Ctrl+C to stop.");
+    rti_logger.notice(
+            "Publishing FlatRawImage messages with FlatData + SHMEM_REF...");
+
+    uint32_t image_count = 0;
+
+    while (!application::shutdown_requested) {
+        try {
+            // Non-blocking loan acquisition - under back-pressure this skips
+            // the frame instead of stalling the publish loop
+            auto sample = image_writer->try_get_loan();
+            if (sample == nullptr) {
+                std::cout << "Loan pool exhausted, frame skipped (total skips: "
+                          << image_writer->loan_exhaustion_count() << ")"
+                          << std::endl;
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+
+            // Build the image directly in the shared-memory sample
+            auto root = sample->root();
+            root.frame_number(image_count);
+            root.timestamp_sec(static_cast<uint32_t>(
+                    std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count()));
+            root.timestamp_nsec(0);
+            root.width(IMAGE_WIDTH);
+            root.height(IMAGE_HEIGHT);
+            root.encoding(::foxglove::FLAT_IMAGE_ENCODING_RGB8);
+            root.step(IMAGE_WIDTH * 3);
+            root.data_length(IMAGE_SIZE);
+
+            // Simulated pixel data, produced in place. Recycled loans come
+            // back with the payload region untouched, so the full-frame fill
+            // only happens on the first pass through the pool
+            if (image_count < static_cast<uint32_t>(LOAN_POOL_DEPTH)) {
+                auto data_array = root.data();
+                uint8_t pattern_value =
+                        static_cast<uint8_t>(image_count % 256);
+                for (uint32_t i = 0; i < IMAGE_SIZE; i++) {
+                    data_array.set_element(i, pattern_value);
+                }
+            }
+
+            // Write the loaned sample - ownership transfers to the writer
+            image_writer->writer().write(*sample);
+
+            std::cout << "[IMAGE_PUBLISHER] Published FlatRawImage - frame: "
+                      << image_count << ", Size: " << IMAGE_SIZE << " bytes"
+                      << " (" << IMAGE_WIDTH << "x" << IMAGE_HEIGHT << ")"
+                      << std::endl;
+
+            image_count++;
+        } catch (const std::exception &ex) {
+            rti_logger.error(
+                    ("Failed to publish image: " + std::string(ex.what()))
+                            .c_str());
+        }
+
+        // Sleep for 10 millseconds
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    rti_logger.notice("Large Data application shutting down...");
+
+    rti_logger.notice("Large Data application stopped");
+}
+
 void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
 {
     auto& rti_logger = rti::config::Logger::instance();
@@ -110,10 +244,17 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
     rti_logger.notice(
             "Publishing Image messages with LARGE_DATA_SHMEM QoS...");
 
-    // Initialize image message
+    // Initialize image message once - reused across iterations so its
+    // members keep their capacity
     ::foxglove::RawImage image_msg;
     uint32_t image_count = 0;
 
+    // Preallocated pixel buffers: ~900 KB per frame no longer comes from
+    // the allocator every iteration
+    DDSBufferPool<std::vector<uint8_t>> buffer_pool(
+            IMAGE_SIZE,
+            BUFFER_POOL_DEPTH);
+
     while (!application::shutdown_requested) {
         try {
             // Create image ID with zero-padded count
@@ -132,25 +273,33 @@ void run(std::shared_ptr<DDSParticipantSetup> participant_setup)
             image_msg.step(IMAGE_WIDTH*3);
 
             // Create simulated image data (pattern based on count for variety)
-            // In real application, this would be actual camera/sensor data
-            std::vector<uint8_t> image_data(IMAGE_SIZE);
+            // In real application, this would be actual camera/sensor data.
+            // The buffer comes from the pool with warmed capacity, so the
+            // resize is a no-op after the first pass
+            std::vector<uint8_t> image_data = buffer_pool.acquire();
+            image_data.resize(IMAGE_SIZE);
             uint8_t pattern_value = static_cast<uint8_t>(image_count % 256);
             std::fill(image_data.begin(), image_data.end(), pattern_value);
 
-            image_msg.data(image_data);
+            // Move the buffer's storage into the sample - no copy
+            image_msg.data(std::move(image_data));
 
             // Publish the image
             image_writer->writer().write(image_msg);
 
+            // write() serializes synchronously, so the storage can go
+            // straight back to the pool for the next frame
+            buffer_pool.release(std::move(image_msg.data()));
+
             std::cout << "[IMAGE_PUBLISHER] Published Image - ID: "
                       << image_msg.frame_id()
-                      << ", Size: " << image_msg.data().size() << " bytes"
+                      << ", Size: " << IMAGE_SIZE << " bytes"
                       << " (" << IMAGE_WIDTH << "x" << IMAGE_HEIGHT << ")"
                       << std::endl;
 
             rti_logger.notice(
                     ("Published Image - id:" + std::string(image_msg.frame_id())
-                     + ", size:" + std::to_string(image_msg.data().size())
+                     + ", size:" + std::to_string(IMAGE_SIZE)
                      + " bytes" + ", " + std::to_string(IMAGE_WIDTH) + "x"
                      + std::to_string(IMAGE_HEIGHT))
                             .c_str());
@@ -241,8 +390,12 @@ int main(int argc, char *argv[])
         //   get_debug_log_level
         dist_logger.set_filter_level(dist_logger.get_info_log_level());
 
-        // Run
-        run(participant_setup);
+        // Run - the --zero-copy flag selects the FlatData/SHMEM_REF types
+        if (arguments.zero_copy) {
+            run_zero_copy(participant_setup);
+        } else {
+            run(participant_setup);
+        }
 
         // Explicitly finalize DistLogger Singleton
         // before Domain Participant destruction
@@ -0,0 +1,237 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_ASYNC_LOGGER_HPP
+#define DDS_ASYNC_LOGGER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * DDSAsyncLogger Class
+ *
+ * Low-overhead logging backend for the wrapper-class hot paths. Status and
+ * data callbacks run on AsyncWaitSet pool threads, and synchronous
+ * std::cout blocks there serialize on the iostream lock; this logger makes
+ * the hot-path cost a single bounded-queue enqueue:
+ *   - Compile-time verbosity: DDS_LOG_COMPILE_LEVEL (0=off, 1=error,
+ *     2=warning, 3=info, 4=debug; default 3) - calls below the level
+ *     compile to nothing, including their message construction
+ *   - Bounded lock-free MPSC queue (Vyukov-style sequenced ring): any
+ *     number of producer threads, drained by one background thread that
+ *     owns the actual stream writes
+ *   - Overflow never blocks a producer: the message is dropped and counted
+ *     (dropped_count), trading completeness for bounded latency
+ *
+ * Usage (normally via the DDS_LOG_* macros below):
+ *   DDS_LOG_INFO("Samples received: " + std::to_string(n));
+ */
+class DDSAsyncLogger {
+public:
+    enum class Level : int { error = 1, warning = 2, info = 3, debug = 4 };
+
+    static DDSAsyncLogger &instance()
+    {
+        static DDSAsyncLogger logger;
+        return logger;
+    }
+
+    // Enqueue a message; never blocks. Returns false (and counts the drop)
+    // when the queue is full.
+    bool log(Level level, std::string text)
+    {
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = _slots[pos & _mask];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t dif = static_cast<intptr_t>(seq)
+                    - static_cast<intptr_t>(pos);
+            if (dif == 0) {
+                if (_enqueue_pos.compare_exchange_weak(
+                            pos,
+                            pos + 1,
+                            std::memory_order_relaxed)) {
+                    slot.level = level;
+                    slot.text = std::move(text);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS failed: pos was reloaded, retry with the new value
+            } else if (dif < 0) {
+                // Queue full - drop rather than stall the callback thread
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Messages dropped because the queue was full
+    size_t dropped_count() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    // Block until everything enqueued so far has been written out
+    void flush()
+    {
+        while (_dequeue_pos.load(std::memory_order_acquire)
+               < _enqueue_pos.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    DDSAsyncLogger(const DDSAsyncLogger &) = delete;
+    DDSAsyncLogger &operator=(const DDSAsyncLogger &) = delete;
+
+private:
+    // Queue depth: bounds both memory and how far the drain thread can lag
+    static const size_t QUEUE_CAPACITY = 1024;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Level level;
+        std::string text;
+    };
+
+    DDSAsyncLogger()
+            : _mask(QUEUE_CAPACITY - 1),
+              _slots(QUEUE_CAPACITY),
+              _enqueue_pos(0),
+              _dequeue_pos(0),
+              _dropped(0),
+              _running(true)
+    {
+        for (size_t i = 0; i < QUEUE_CAPACITY; i++) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        _drain_thread = std::thread([this]() { drain_loop(); });
+    }
+
+    ~DDSAsyncLogger()
+    {
+        _running.store(false, std::memory_order_release);
+        if (_drain_thread.joinable()) {
+            _drain_thread.join();
+        }
+        drain_available();  // write out anything still queued
+
+        const size_t dropped = dropped_count();
+        if (dropped > 0) {
+            std::cout << "[DDSAsyncLogger] messages dropped (queue full): "
+                      << dropped << std::endl;
+        }
+    }
+
+    // Single consumer: pops every ready slot and writes it to the stream
+    void drain_available()
+    {
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = _slots[pos & _mask];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            if (seq != pos + 1) {
+                break;  // next slot not published yet
+            }
+
+            write_line(slot.level, slot.text);
+            slot.text.clear();
+            slot.sequence.store(
+                    pos + QUEUE_CAPACITY,
+                    std::memory_order_release);
+            pos++;
+        }
+        _dequeue_pos.store(pos, std::memory_order_release);
+    }
+
+    void drain_loop()
+    {
+        while (_running.load(std::memory_order_acquire)) {
+            drain_available();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    static void write_line(Level level, const std::string &text)
+    {
+        const char *tag = "INFO";
+        switch (level) {
+        case Level::error:
+            tag = "ERROR";
+            break;
+        case Level::warning:
+            tag = "WARN";
+            break;
+        case Level::info:
+            tag = "INFO";
+            break;
+        case Level::debug:
+            tag = "DEBUG";
+            break;
+        }
+        // Only this thread touches the stream, so one << chain per line is
+        // enough to keep lines whole
+        std::cout << "[" << tag << "] " << text << "\n";
+    }
+
+    const size_t _mask;
+    std::vector<Slot> _slots;
+    std::atomic<size_t> _enqueue_pos;
+    std::atomic<size_t> _dequeue_pos;
+    std::atomic<size_t> _dropped;
+    std::atomic<bool> _running;
+    std::thread _drain_thread;
+};
+
+// Compile-time verbosity: calls below DDS_LOG_COMPILE_LEVEL vanish entirely,
+// message expression included
+#ifndef DDS_LOG_COMPILE_LEVEL
+    #define DDS_LOG_COMPILE_LEVEL 3
+#endif
+
+#if DDS_LOG_COMPILE_LEVEL >= 1
+    #define DDS_LOG_ERROR(msg) \
+        DDSAsyncLogger::instance().log(DDSAsyncLogger::Level::error, (msg))
+#else
+    #define DDS_LOG_ERROR(msg) ((void) 0)
+#endif
+
+#if DDS_LOG_COMPILE_LEVEL >= 2
+    #define DDS_LOG_WARNING(msg) \
+        DDSAsyncLogger::instance().log(DDSAsyncLogger::Level::warning, (msg))
+#else
+    #define DDS_LOG_WARNING(msg) ((void) 0)
+#endif
+
+#if DDS_LOG_COMPILE_LEVEL >= 3
+    #define DDS_LOG_INFO(msg) \
+        DDSAsyncLogger::instance().log(DDSAsyncLogger::Level::info, (msg))
+#else
+    #define DDS_LOG_INFO(msg) ((void) 0)
+#endif
+
+#if DDS_LOG_COMPILE_LEVEL >= 4
+    #define DDS_LOG_DEBUG(msg) \
+        DDSAsyncLogger::instance().log(DDSAsyncLogger::Level::debug, (msg))
+#else
+    #define DDS_LOG_DEBUG(msg) ((void) 0)
+#endif
+
+#endif  // DDS_ASYNC_LOGGER_HPP
@@ -0,0 +1,109 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_BUFFER_POOL_HPP
+#define DDS_BUFFER_POOL_HPP
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * DDSBufferPool Class
+ *
+ * Fixed-depth pool of reusable payload buffers for publisher loops that fill
+ * a large data member (sequence<octet> -> std::vector<uint8_t>, or string)
+ * every iteration. Allocating a fresh buffer per frame costs an allocation,
+ * a fill and a copy into the sample - at camera rates that is tens of MB/s
+ * of allocator churn. With the pool, the buffer's storage cycles between the
+ * pool and the sample by move, so steady state does zero allocations:
+ *
+ *   DDSBufferPool<std::vector<uint8_t>> pool(IMAGE_SIZE, 4);
+ *   ...
+ *   auto buffer = pool.acquire();        // warmed capacity, cleared
+ *   buffer.resize(IMAGE_SIZE);
+ *   fill(buffer);
+ *   image_msg.data(std::move(buffer));   // storage moves into the sample
+ *   writer.write(image_msg);             // write serializes synchronously
+ *   pool.release(std::move(image_msg.data()));  // storage moves back
+ *
+ * Keep the sample object (image_msg above) alive across iterations too -
+ * its other members then also retain their capacity.
+ *
+ * BufferT needs reserve()/clear() and move semantics: std::vector and
+ * std::string both qualify. acquire() under an empty pool allocates a fresh
+ * buffer rather than blocking, and counts the miss (pool_misses) so an
+ * undersized pool is visible.
+ */
+template <typename BufferT = std::vector<uint8_t>>
+class DDSBufferPool {
+public:
+    // Preallocate pool_depth buffers, each with buffer_size reserved
+    DDSBufferPool(size_t buffer_size, size_t pool_depth)
+            : _buffer_size(buffer_size), _pool_depth(pool_depth)
+    {
+        _free.reserve(pool_depth);
+        for (size_t i = 0; i < pool_depth; i++) {
+            BufferT buffer;
+            buffer.reserve(buffer_size);
+            _free.push_back(std::move(buffer));
+        }
+    }
+
+    // Take a cleared buffer with warmed capacity from the pool. Falls back
+    // to a fresh allocation (counted) when every pooled buffer is in flight.
+    BufferT acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_free.empty()) {
+                BufferT buffer = std::move(_free.back());
+                _free.pop_back();
+                return buffer;
+            }
+        }
+        _pool_misses.fetch_add(1, std::memory_order_relaxed);
+        BufferT buffer;
+        buffer.reserve(_buffer_size);
+        return buffer;
+    }
+
+    // Return a buffer's storage to the pool. clear() keeps the capacity, so
+    // the next acquire reuses the same allocation. Buffers beyond the pool
+    // depth (from misses) are simply dropped.
+    void release(BufferT &&buffer)
+    {
+        buffer.clear();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_free.size() < _pool_depth) {
+            _free.push_back(std::move(buffer));
+        }
+    }
+
+    // Number of acquire calls that found the pool empty and allocated
+    size_t pool_misses() const
+    {
+        return _pool_misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    const size_t _buffer_size;
+    const size_t _pool_depth;
+    std::mutex _mutex;
+    std::vector<BufferT> _free;
+    std::atomic<size_t> _pool_misses{0};
+};
+
+#endif  // DDS_BUFFER_POOL_HPP
@@ -17,6 +17,7 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
@@ -40,11 +41,16 @@ using namespace rti::all;
  *   - Writers publish requests to any server (servers filter on node_id)
  *   - Readers receive responses and filter on request_id
  *   - Single set of endpoints for all target nodes
- * 
+ *   - Optional local cache: enable_cache() serves repeated gets from memory
+ *     and keeps entries fresh from the ParameterEvent topic the servers
+ *     already publish on every set/delete, so a bulk get only round-trips
+ *     for names the cache has never seen
+ *
  * Usage:
  *   DDSClientParameterSetup client(participant, event_callback);
+ *   client.enable_cache();
  *   client.set_parameters("robot1", params);
- *   client.set_parameters("robot2", other_params);
+ *   client.get_parameters("robot1", {"gain", "rate"});  // served locally
  */
 class DDSClientParameterSetup {
 public:
@@ -139,6 +145,86 @@ public:
         return results;
     }
 
+    //--------------------------------------------------------------------------
+    // Local Cache
+    //--------------------------------------------------------------------------
+
+    /**
+     * Opt into the local parameter cache. From this point on get_parameters
+     * serves cached names from memory and only round-trips for misses, and
+     * every ParameterEvent from a server updates or evicts the affected
+     * entries. Events are subscribed regardless - enabling the cache only
+     * changes what the event handler does with them.
+     */
+    void enable_cache()
+    {
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        _cache_enabled = true;
+        std::cout << "[DDSClientParameterSetup] Local parameter cache enabled"
+                  << std::endl;
+    }
+
+    /** Drop every cached entry (e.g. after a known server restart). */
+    void invalidate_cache()
+    {
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        _cache.clear();
+    }
+
+    size_t cache_size() const
+    {
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        return _cache.size();
+    }
+
+    /**
+     * Bulk get that consults the cache first. Cached names never leave the
+     * process; only the misses are fetched in one request/reply round trip
+     * and inserted for next time. Falls back to plain get_parameters when
+     * the cache is disabled.
+     * @throws std::runtime_error if the miss fetch times out
+     */
+    std::vector<example_types::Parameter> get_parameters_cached(
+        const std::string& target_node,
+        const std::vector<std::string>& names,
+        const dds::core::Duration& timeout = dds::core::Duration::from_secs(5))
+    {
+        if (!_cache_enabled) {
+            return get_parameters(target_node, names, timeout);
+        }
+
+        std::vector<std::string> misses;
+        {
+            std::lock_guard<std::mutex> lock(_cache_mutex);
+            for (const auto& name : names) {
+                if (_cache.find(cache_key(target_node, name)) == _cache.end()) {
+                    misses.push_back(name);
+                }
+            }
+        }
+
+        if (!misses.empty()) {
+            auto fetched = get_parameters(target_node, misses, timeout);
+            std::lock_guard<std::mutex> lock(_cache_mutex);
+            for (const auto& p : fetched) {
+                _cache[cache_key(target_node, std::string(p.name()))] = p;
+            }
+        }
+
+        // Assemble results in requested order; names unknown to the server
+        // are absent from the cache and are skipped, matching the uncached
+        // behavior
+        std::vector<example_types::Parameter> results;
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        for (const auto& name : names) {
+            auto it = _cache.find(cache_key(target_node, name));
+            if (it != _cache.end()) {
+                results.push_back(it->second);
+            }
+        }
+        return results;
+    }
+
     std::vector<example_types::Parameter> get_parameters(
         const std::string& target_node,
         std::initializer_list<std::string> names,
@@ -224,21 +310,56 @@ private:
         _list_response_reader = std::make_shared<DDSReaderSetup<example_types::ListParametersResponse>>(
             _participant_setup, topics::LIST_PARAMETERS_RESPONSE_TOPIC, _qos_profile);
         
-        // Event subscriber
+        // Event subscriber - always handled: events keep the local cache
+        // fresh and are forwarded to the application callback if one is set
         _event_reader = std::make_shared<DDSReaderSetup<example_types::ParameterEvent>>(
             _participant_setup, topics::PARAMETER_EVENTS_TOPIC, _qos_profile);
-        
-        if (_event_callback) {
-            _event_reader->set_data_available_handler(
-                [this](dds::sub::DataReader<example_types::ParameterEvent>& reader) {
-                    auto samples = reader.take();
-                    for (const auto& sample : samples) {
-                        if (sample.info().valid() && _event_callback) {
-                            _event_callback(sample.data());
-                        }
+
+        _event_reader->set_data_available_handler(
+            [this](dds::sub::DataReader<example_types::ParameterEvent>& reader) {
+                auto samples = reader.take();
+                for (const auto& sample : samples) {
+                    if (!sample.info().valid()) continue;
+                    apply_event_to_cache(sample.data());
+                    if (_event_callback) {
+                        _event_callback(sample.data());
                     }
-                });
+                }
+            });
+    }
+
+    // Update/evict cache entries from a server-side ParameterEvent: new and
+    // changed parameters overwrite their entries in place, deleted ones are
+    // evicted. Entries the cache never held are ignored - the cache only
+    // tracks what the application actually reads.
+    void apply_event_to_cache(const example_types::ParameterEvent& event)
+    {
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        if (!_cache_enabled) {
+            return;
         }
+
+        const std::string node(event.node_id());
+        for (const auto& p : event.new_parameters()) {
+            auto it = _cache.find(cache_key(node, std::string(p.name())));
+            if (it != _cache.end()) {
+                it->second = p;
+            }
+        }
+        for (const auto& p : event.changed_parameters()) {
+            auto it = _cache.find(cache_key(node, std::string(p.name())));
+            if (it != _cache.end()) {
+                it->second = p;
+            }
+        }
+        for (const auto& p : event.deleted_parameters()) {
+            _cache.erase(cache_key(node, std::string(p.name())));
+        }
+    }
+
+    static std::string cache_key(const std::string& node, const std::string& name)
+    {
+        return node + "/" + name;
     }
 
 private:
@@ -247,6 +368,11 @@ private:
     ParameterEventCallback _event_callback;
     std::atomic<uint64_t> _next_request_id;
 
+    // Local cache keyed by "node/name", maintained by the event handler
+    mutable std::mutex _cache_mutex;
+    std::unordered_map<std::string, example_types::Parameter> _cache;
+    std::atomic<bool> _cache_enabled{false};
+
     // Request writers
     std::shared_ptr<DDSWriterSetup<example_types::SetParametersRequest>> _set_request_writer;
     std::shared_ptr<DDSWriterSetup<example_types::GetParametersRequest>> _get_request_writer;
@@ -0,0 +1,184 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_COROUTINE_EXECUTOR_HPP
+#define DDS_COROUTINE_EXECUTOR_HPP
+
+// This header is active only when the target is built with C++20 coroutine
+// support (set_property(TARGET <app> PROPERTY CXX_STANDARD 20)); on the
+// kit's default C++14 targets it compiles to nothing and DDSReaderSetup
+// keeps its callback-only API. DDS_UTILS_HAS_COROUTINES is the guard the
+// rest of the utils use to expose coroutine members.
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <rti/rti.hpp>
+
+#define DDS_UTILS_HAS_COROUTINES 1
+
+/*
+ * DDSCoroutineExecutor Class
+ *
+ * Single-threaded driver for the coroutine read API in DDSReaderSetup
+ * (next_sample() / next_batch()). The callback model dispatches every
+ * reader on the shared AsyncWaitSet thread pool, which forces apps with
+ * sequential multi-topic logic (correlate a Command with its Config and
+ * Status) into shared-state mutexes between handlers. With the executor,
+ * that pipeline is one coroutine:
+ *
+ *   DDSCoroutineTask correlate(DDSCoroutineExecutor &executor, ...)
+ *   {
+ *       while (!application::shutdown_requested) {
+ *           auto commands = co_await command_reader->next_sample(executor);
+ *           auto status = co_await status_reader->next_batch(executor);
+ *           // sequential logic, no locks - everything runs on run()'s thread
+ *       }
+ *   }
+ *
+ *   auto task = correlate(executor, ...);   // runs to the first co_await
+ *   executor.run();                         // drives all awaiting readers
+ *
+ * One OS thread (pin it if the node is latency-sensitive) multiplexes any
+ * number of awaiting readers over a single WaitSet: a co_await parks the
+ * coroutine on a ReadCondition, and run() resumes it when data arrives.
+ * There are no per-handler locks and no cross-thread wakeups because
+ * nothing else touches the coroutines' state.
+ *
+ * Threading contract: awaitables must be created and resumed on the run()
+ * thread only (start tasks before run(), or from inside another task), and
+ * each reader should have a single awaiting consumer at a time.
+ */
+class DDSCoroutineExecutor {
+public:
+    DDSCoroutineExecutor()
+    {
+        // Wakes the dispatch loop so stop() takes effect without waiting
+        // out the dispatch timeout
+        _stop_condition->handler([this](dds::core::cond::Condition) {
+            _stop_condition.trigger_value(false);
+        });
+        _waitset.attach_condition(_stop_condition);
+    }
+
+    DDSCoroutineExecutor(const DDSCoroutineExecutor &) = delete;
+    DDSCoroutineExecutor &operator=(const DDSCoroutineExecutor &) = delete;
+
+    // Dispatch loop - blocks until stop() is called. Conditions armed by
+    // awaitables queue their coroutine handles during dispatch; the queue
+    // is drained (and handles resumed) outside dispatch so a resumed
+    // coroutine can safely attach its next condition.
+    void run()
+    {
+        while (!_stop) {
+            try {
+                _waitset.dispatch(dds::core::Duration::from_millisecs(250));
+            } catch (const dds::core::TimeoutError &) {
+                // No data this period; loop to re-check _stop
+            }
+
+            for (auto &condition : _detach_queue) {
+                _waitset.detach_condition(condition);
+            }
+            _detach_queue.clear();
+
+            std::vector<std::coroutine_handle<>> ready;
+            ready.swap(_ready_queue);
+            for (auto handle : ready) {
+                handle.resume();
+            }
+        }
+    }
+
+    // Request run() to return; safe to call from inside a coroutine
+    void stop()
+    {
+        _stop = true;
+        _stop_condition.trigger_value(true);
+    }
+
+    // Used by the awaitables in DDSReaderSetup: park `handle` until
+    // `condition` triggers. The condition is detached again before the
+    // resume, so every co_await is a fresh one-shot arm. The handler
+    // must not capture the condition - its closure is stored on the
+    // condition itself, and the self-reference would keep every
+    // per-co_await ReadCondition alive forever; the triggered condition
+    // arrives as the handler's parameter instead.
+    void await_condition(
+            dds::core::cond::Condition condition,
+            std::coroutine_handle<> handle)
+    {
+        condition->handler([this, handle](dds::core::cond::Condition triggered) {
+            _detach_queue.push_back(triggered);
+            _ready_queue.push_back(handle);
+        });
+        _waitset.attach_condition(condition);
+    }
+
+private:
+    dds::core::cond::WaitSet _waitset;
+    rti::core::cond::GuardCondition _stop_condition;
+    std::vector<std::coroutine_handle<>> _ready_queue;
+    std::vector<dds::core::cond::Condition> _detach_queue;
+    bool _stop = false;
+};
+
+/*
+ * DDSCoroutineTask - detached task type for executor-driven coroutines
+ *
+ * Eagerly started: the body runs on the caller's thread until the first
+ * co_await, which parks it on the executor. The frame cleans itself up
+ * when the body returns, so the returned object is just a start token -
+ * keep the coroutine's captured references alive until executor.run()
+ * returns. Exceptions escaping the body are logged and end that task
+ * only; the executor keeps driving the others.
+ */
+struct DDSCoroutineTask {
+    struct promise_type {
+        DDSCoroutineTask get_return_object()
+        {
+            return DDSCoroutineTask();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            try {
+                std::rethrow_exception(std::current_exception());
+            } catch (const std::exception &e) {
+                std::cerr << "Exception in coroutine task: " << e.what()
+                          << std::endl;
+            }
+        }
+    };
+};
+
+#endif  // defined(__cpp_impl_coroutine)
+
+#endif  // DDS_COROUTINE_EXECUTOR_HPP
@@ -0,0 +1,242 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_GEOJSON_BUILDER_HPP
+#define DDS_GEOJSON_BUILDER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+
+/*
+ * DDSGeoJsonBuilder Class
+ *
+ * Allocation-free incremental GeoJSON assembly for foxglove::GeoJSON
+ * publishers. Building a live track polyline with thousands of
+ * coordinates through std::ostringstream / std::to_string at 10 Hz
+ * dominates the publisher core; this builder writes characters straight
+ * into one preallocated buffer and re-serializes nothing that has not
+ * changed:
+ *
+ *   - Caller-owned Buffer: capacity is reserved once at construction
+ *                          (GeoJSON.idl's string is unbounded, so the
+ *                          bound is the builder's); an append that would
+ *                          exceed it is dropped and flagged via
+ *                          overflowed() rather than reallocating
+ *   - Incremental Geometry: the document is laid out so all growth is at
+ *                           the tail - properties come before the
+ *                           coordinates array, and the closing brackets
+ *                           are a fixed suffix. finalize() appends the
+ *                           suffix; reopen() truncates it again, so the
+ *                           next cycle appends only the new coordinates
+ *                           and the unchanged polyline prefix is never
+ *                           re-serialized
+ *   - Move Handoff: take() moves the buffer into the sample's string
+ *                   field with no copy; after the (synchronous) write,
+ *                   reclaim() moves it back with contents and state
+ *                   intact, following the DDSBufferPool acquire/release
+ *                   pattern
+ *
+ * Usage per cycle:
+ *
+ *   builder.add_point(lon, lat);          // new coordinates only
+ *   builder.finalize();
+ *   msg.geojson(builder.take());
+ *   writer.write(msg);
+ *   builder.reclaim(std::move(msg.geojson()));
+ *   builder.reopen();                     // ready to extend next cycle
+ */
+class DDSGeoJsonBuilder {
+public:
+    explicit DDSGeoJsonBuilder(size_t capacity)
+            : _capacity(capacity)
+    {
+        _buffer.reserve(_capacity);
+    }
+
+    // Start a FeatureCollection holding one named LineString feature.
+    // Properties precede the geometry so every later append lands at the
+    // document tail.
+    void begin_line_string(const char *name)
+    {
+        _buffer.clear();
+        _overflowed = false;
+        _point_count = 0;
+        _finalized = false;
+
+        append_raw(
+                "{\"type\":\"FeatureCollection\",\"features\":"
+                "[{\"type\":\"Feature\",\"properties\":{\"name\":\"");
+        append_escaped(name);
+        append_raw(
+                "\"},\"geometry\":{\"type\":\"LineString\","
+                "\"coordinates\":[");
+
+        // A capacity too small for even the document skeleton leaves an
+        // empty (rather than truncated) buffer
+        if (_overflowed) {
+            _buffer.clear();
+        }
+        _geometry_end = _buffer.size();
+    }
+
+    // Append one [lon,lat] pair at the geometry tail. Decimal places
+    // default to 6 (~0.1 m of longitude), which keeps the per-point cost
+    // and the payload bound predictable.
+    void add_point(double longitude, double latitude, int decimals = 6)
+    {
+        if (_finalized) {
+            reopen();
+        }
+        if (_buffer.empty()) {
+            // No document skeleton (begin_line_string overflowed)
+            _overflowed = true;
+            return;
+        }
+
+        char scratch[64];
+        const int written = snprintf(
+                scratch,
+                sizeof(scratch),
+                "%s[%.*f,%.*f]",
+                _point_count == 0 ? "" : ",",
+                decimals,
+                longitude,
+                decimals,
+                latitude);
+        if (written > 0) {
+            append_raw(scratch, static_cast<size_t>(written));
+        }
+        if (!_overflowed) {
+            _point_count++;
+            _geometry_end = _buffer.size();
+        }
+    }
+
+    // Close the coordinates array and the document with the fixed suffix
+    void finalize()
+    {
+        if (_finalized || _buffer.empty()) {
+            return;
+        }
+        append_raw("]}}]}");
+        _finalized = true;
+    }
+
+    // Drop the fixed suffix so the geometry can be extended in place
+    void reopen()
+    {
+        if (_finalized) {
+            _buffer.resize(_geometry_end);
+            _finalized = false;
+        }
+    }
+
+    // Move the document out for the sample's string field. The builder
+    // is empty until reclaim() returns the storage.
+    std::string take()
+    {
+        return std::move(_buffer);
+    }
+
+    // Return the storage after the write; contents and builder state are
+    // unchanged, so the next cycle continues incrementally. A buffer of
+    // the wrong size (the string was modified or copied) resets the
+    // builder instead of corrupting the document.
+    void reclaim(std::string &&buffer)
+    {
+        _buffer = std::move(buffer);
+        if (_buffer.size() != (_finalized ? _geometry_end + SUFFIX_LENGTH
+                                          : _geometry_end)) {
+            std::cerr << "DDSGeoJsonBuilder: reclaimed buffer does not match "
+                         "builder state; resetting" << std::endl;
+            _buffer.clear();
+            _buffer.reserve(_capacity);
+            _point_count = 0;
+            _geometry_end = 0;
+            _finalized = false;
+        }
+    }
+
+    size_t point_count() const
+    {
+        return _point_count;
+    }
+
+    size_t size() const
+    {
+        return _buffer.size();
+    }
+
+    // True when an append was dropped because it would exceed capacity;
+    // the document stays well-formed, just without the dropped points
+    bool overflowed() const
+    {
+        return _overflowed;
+    }
+
+private:
+    static constexpr size_t SUFFIX_LENGTH = 5;  // strlen("]}}]}")
+
+    void append_raw(const char *text)
+    {
+        append_raw(text, strlen(text));
+    }
+
+    void append_raw(const char *text, size_t length)
+    {
+        // Leave headroom for the closing suffix so finalize() always fits
+        if (_buffer.size() + length + SUFFIX_LENGTH > _capacity) {
+            _overflowed = true;
+            return;
+        }
+        _buffer.append(text, length);
+    }
+
+    // Minimal JSON string escaping for property values
+    void append_escaped(const char *text)
+    {
+        for (const char *c = text; *c != '\0'; c++) {
+            switch (*c) {
+            case '"':
+                append_raw("\\\"", 2);
+                break;
+            case '\\':
+                append_raw("\\\\", 2);
+                break;
+            case '\n':
+                append_raw("\\n", 2);
+                break;
+            case '\t':
+                append_raw("\\t", 2);
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) >= 0x20) {
+                    append_raw(c, 1);
+                }
+                break;
+            }
+        }
+    }
+
+    std::string _buffer;
+    size_t _capacity;
+    size_t _geometry_end = 0;
+    size_t _point_count = 0;
+    bool _finalized = false;
+    bool _overflowed = false;
+};
+
+#endif  // DDS_GEOJSON_BUILDER_HPP
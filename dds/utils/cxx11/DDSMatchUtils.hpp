@@ -0,0 +1,52 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_MATCH_UTILS_HPP
+#define DDS_MATCH_UTILS_HPP
+
+#include <future>
+#include <vector>
+
+/*
+ * Match Future Utilities
+ *
+ * Combinators for the match futures returned by
+ * DDSWriterSetup::match_future and DDSReaderSetup::match_future. An
+ * application with many endpoints collects one future per endpoint and
+ * blocks once until the whole entity graph is wired:
+ *
+ *   std::vector<std::shared_future<void>> wiring;
+ *   wiring.push_back(command_writer->match_future(1));
+ *   wiring.push_back(status_reader->match_future(2));
+ *   match_utils::all_of(wiring).wait();
+ */
+namespace match_utils {
+
+// Future that completes when every input future has completed. Deferred:
+// the waiting happens on whichever thread calls wait()/get(), so no extra
+// thread is spawned.
+inline std::shared_future<void> all_of(
+        std::vector<std::shared_future<void>> futures)
+{
+    return std::async(
+                   std::launch::deferred,
+                   [futures]() {
+                       for (const auto &future : futures) {
+                           future.wait();
+                       }
+                   })
+            .share();
+}
+
+}  // namespace match_utils
+
+#endif  // DDS_MATCH_UTILS_HPP
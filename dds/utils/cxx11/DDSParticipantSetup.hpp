@@ -3,9 +3,12 @@
 
 #include <iostream>
 #include <csignal>
+#include <fstream>
 #include <string>
 #include <mutex>
+#include <map>
 #include <unordered_map>
+#include <vector>
 #include <thread>
 #include <chrono>
 
@@ -24,12 +27,84 @@ using namespace rti::all;
  *   - AsyncWaitSet: Centrally managed event dispatcher that handles all DDS status events
  *                   (data available, publication matched, liveliness changes, etc.) across
  *                   all readers and writers in asynchronous thread pool
+ *   - Waitset Lanes: Optional named AsyncWaitSets (e.g. "control", "bulk",
+ *                    "status"), each with its own thread-pool size and CPU
+ *                    affinity, so a slow handler on a bulk topic cannot
+ *                    head-of-line block latency-critical topics. Readers and
+ *                    writers select a lane at construction; the unnamed
+ *                    default lane preserves the original single-waitset
+ *                    behavior
  *   - QoS File Path: Stores the path to XML QoS configuration file for reuse by readers/writers
- * 
+ *   - QosProvider: Single shared provider that parses the QoS XML file once at
+ *                  startup; readers/writers request profile QoS through the
+ *                  memoized lookup methods instead of re-parsing per entity
+ *   - Discovery Fast Path: An optional DiscoveryFastPath puts programmatic
+ *                          initial peers and an aggressive initial
+ *                          announcement schedule on the participant so
+ *                          multi-node startup does not wait on multicast
+ *                          discovery rounds; pairs with the
+ *                          DPLibrary::FastDiscoveryParticipant profile for
+ *                          the XML-configured equivalent
+ *   - Transport Tuning: An optional WorkloadHint (max sample size, expected
+ *                       rate) makes the constructor size the UDPv4 socket
+ *                       buffers and SHMEM segment to the workload, check the
+ *                       kernel rmem_max/wmem_max limits the way
+ *                       tools/optimize_socket_buffers.sh raises them, and
+ *                       loudly report limits it cannot fix from user space -
+ *                       undersized buffers are the usual cause of silent
+ *                       sample_lost storms with multi-MB samples
+ *
  * The AsyncWaitSet enables event-driven processing with configurable thread pool size,
  * allowing readers and writers to register status conditions and callbacks that execute
  * asynchronously when events occur.
  */
+
+/*
+ * Declares the transport demands of an application so DDSParticipantSetup can
+ * size the builtin transports for it. Pass the largest sample the app moves
+ * (e.g. example_types::MAX_IMAGE_DATA_SIZE) and the expected publish rate;
+ * a default-constructed hint (max_sample_size_bytes == 0) disables tuning.
+ */
+struct TransportWorkloadHint {
+    size_t max_sample_size_bytes = 0;
+    int expected_rate_hz = 10;
+
+    TransportWorkloadHint() = default;
+    TransportWorkloadHint(size_t sample_size_bytes, int rate_hz)
+            : max_sample_size_bytes(sample_size_bytes),
+              expected_rate_hz(rate_hz)
+    {
+    }
+};
+
+/*
+ * Programmatic discovery fast-path settings for DDSParticipantSetup, for
+ * peer sets only known at runtime (the FastDiscoveryParticipant profile is
+ * the XML equivalent). A default-constructed instance leaves discovery as
+ * the profile configured it.
+ */
+struct DiscoveryFastPath {
+    // Unicast peers to contact directly (e.g. "udpv4://192.168.1.10",
+    // "shmem://"). Non-empty skips waiting on multicast rounds.
+    std::vector<std::string> initial_peers;
+
+    // Restrict discovery to the listed peers: stop listening on the
+    // multicast discovery address and ignore announcements from unlisted
+    // participants. Cuts discovery traffic on closed systems where the
+    // peer set is fully known.
+    bool peers_only = false;
+
+    // Initial announcement burst (0 keeps the profile's schedule)
+    int initial_announcements = 0;
+    int min_announcement_period_ms = 10;
+    int max_announcement_period_ms = 100;
+
+    bool enabled() const
+    {
+        return !initial_peers.empty() || initial_announcements > 0;
+    }
+};
+
 class DDSParticipantSetup {
 private:
     const int _domain_id;
@@ -41,13 +116,29 @@ private:
     // Async Waitset - centrally managed
     rti::core::cond::AsyncWaitSet _async_waitset = dds::core::null;
 
+    // Named waitset lanes with dedicated thread pools (unordered_map keeps
+    // references stable, so handed-out lane references stay valid)
+    std::mutex _lanes_mutex;
+    std::unordered_map<std::string, rti::core::cond::AsyncWaitSet> _waitset_lanes;
+
+    // Shared QosProvider - parses the QoS XML file exactly once
+    dds::core::QosProvider _qos_provider = dds::core::null;
+
+    // Profile-to-QoS memoization caches keyed by "profile|topic" so repeated
+    // lookups for the same profile don't re-walk the provider's profile tree
+    std::mutex _qos_cache_mutex;
+    std::map<std::string, dds::sub::qos::DataReaderQos> _datareader_qos_cache;
+    std::map<std::string, dds::pub::qos::DataWriterQos> _datawriter_qos_cache;
+
 public:
     DDSParticipantSetup(
             const int domain_id,
             const int thread_pool_size = 5,
             const std::string &participant_qos_file = "",
             const std::string &participant_qos_profile = "",
-            const std::string &app_name = "RTI_DDS_Application")
+            const std::string &app_name = "RTI_DDS_Application",
+            const TransportWorkloadHint &workload = TransportWorkloadHint(),
+            const DiscoveryFastPath &discovery = DiscoveryFastPath())
             : _domain_id(domain_id),
               _qos_file_path(participant_qos_file),
               _async_waitset(
@@ -56,16 +147,28 @@ public:
         try {
             if (!participant_qos_file.empty()
                 && !participant_qos_profile.empty()) {
-                // Create QosProvider and DomainParticipant with profile
-                dds::core::QosProvider qos_provider(participant_qos_file);
+                // Create the shared QosProvider once - the XML file is parsed
+                // here and never again for the lifetime of this setup
+                _qos_provider = dds::core::QosProvider(participant_qos_file);
 
                 auto participant_qos =
-                        qos_provider.participant_qos(participant_qos_profile);
+                        _qos_provider.participant_qos(participant_qos_profile);
 
                 // Name the Participant so it's easier to track
                 participant_qos
                         << rti::core::policy::EntityName().name(app_name);
 
+                // Size the builtin transports for the declared workload
+                if (workload.max_sample_size_bytes > 0) {
+                    apply_transport_tuning(participant_qos, workload);
+                }
+
+                // Put the runtime peer list / announcement burst on the
+                // participant before creation
+                if (discovery.enabled()) {
+                    apply_discovery_fast_path(participant_qos, discovery);
+                }
+
                 // Create Participant
                 _participant = dds::domain::DomainParticipant(
                         _domain_id,
@@ -94,11 +197,21 @@ public:
 
     ~DDSParticipantSetup()
     {
+        // Stop all waitset lanes before destruction
+        for (auto &lane : _waitset_lanes) {
+            try {
+                lane.second.stop();
+            } catch (const std::exception &e) {
+                std::cerr << "Error stopping waitset lane '" << lane.first
+                          << "' during destruction: " << e.what() << std::endl;
+            }
+        }
+
         // Stop AsyncWaitSet before destruction
         try {
             _async_waitset.stop();
         } catch (const std::exception &e) {
-            std::cerr << "Error stopping AsyncWaitSet during destruction: " 
+            std::cerr << "Error stopping AsyncWaitSet during destruction: "
                       << e.what() << std::endl;
         }
 
@@ -117,13 +230,269 @@ public:
         return _async_waitset;
     }
 
+    // Create a named waitset lane with its own thread pool. An optional CPU
+    // list pins the lane's pool threads so latency-critical lanes can own
+    // dedicated cores while bulk lanes soak the rest.
+    void add_waitset_lane(
+            const std::string &lane_name,
+            const int thread_pool_size,
+            const std::vector<int32_t> &cpu_list = std::vector<int32_t>())
+    {
+        if (lane_name.empty()) {
+            std::cerr << "Error: Waitset lane name must not be empty" << std::endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_lanes_mutex);
+        if (_waitset_lanes.find(lane_name) != _waitset_lanes.end()) {
+            std::cout << "Waitset lane '" << lane_name << "' already created"
+                      << std::endl;
+            return;
+        }
+
+        AsyncWaitSetProperty property;
+        property.thread_pool_size(thread_pool_size);
+
+        if (!cpu_list.empty()) {
+            rti::core::ThreadSettings thread_settings;
+            thread_settings.cpu_list(cpu_list);
+            thread_settings.cpu_rotation(
+                    rti::core::ThreadSettingsCpuRotationKind::ROUND_ROBIN);
+            property.thread_settings(thread_settings);
+        }
+
+        _waitset_lanes.emplace(
+                lane_name,
+                rti::core::cond::AsyncWaitSet(property));
+
+        std::cout << "Created waitset lane '" << lane_name << "' with "
+                  << thread_pool_size << " threads"
+                  << (cpu_list.empty() ? "" : " (CPU pinned)") << std::endl;
+    }
+
+    // Getter for a named waitset lane. Unknown or empty lane names fall back
+    // to the default AsyncWaitSet so lane selection is always safe.
+    rti::core::cond::AsyncWaitSet &async_waitset(const std::string &lane_name)
+    {
+        if (lane_name.empty()) {
+            return _async_waitset;
+        }
+
+        std::lock_guard<std::mutex> lock(_lanes_mutex);
+        auto it = _waitset_lanes.find(lane_name);
+        if (it == _waitset_lanes.end()) {
+            std::cerr << "Warning: Waitset lane '" << lane_name
+                      << "' not found, using default AsyncWaitSet" << std::endl;
+            return _async_waitset;
+        }
+        return it->second;
+    }
+
     // Getter for QoS file path
     const std::string &qos_file_path() const
     {
         return _qos_file_path;
     }
 
+    // Getter for the shared QosProvider (dds::core::null if no QoS file)
+    dds::core::QosProvider &qos_provider()
+    {
+        return _qos_provider;
+    }
+
+    // Memoized topic-aware DataReaderQos lookup. The first request for a
+    // profile/topic pair walks the provider's profile tree; every subsequent
+    // request is served from the cache.
+    dds::sub::qos::DataReaderQos datareader_qos(
+            const std::string &qos_profile,
+            const std::string &topic_name)
+    {
+        std::lock_guard<std::mutex> lock(_qos_cache_mutex);
+        const std::string key = qos_profile + "|" + topic_name;
+        auto it = _datareader_qos_cache.find(key);
+        if (it != _datareader_qos_cache.end()) {
+            return it->second;
+        }
+        auto qos = _qos_provider.extensions().datareader_qos_w_topic_name(
+                qos_profile,
+                topic_name);
+        _datareader_qos_cache[key] = qos;
+        return qos;
+    }
+
+    // Memoized topic-aware DataWriterQos lookup (see datareader_qos)
+    dds::pub::qos::DataWriterQos datawriter_qos(
+            const std::string &qos_profile,
+            const std::string &topic_name)
+    {
+        std::lock_guard<std::mutex> lock(_qos_cache_mutex);
+        const std::string key = qos_profile + "|" + topic_name;
+        auto it = _datawriter_qos_cache.find(key);
+        if (it != _datawriter_qos_cache.end()) {
+            return it->second;
+        }
+        auto qos = _qos_provider.extensions().datawriter_qos_w_topic_name(
+                qos_profile,
+                topic_name);
+        _datawriter_qos_cache[key] = qos;
+        return qos;
+    }
+
     // Additional public methods can be added here
+
+private:
+    // Read a kernel limit such as /proc/sys/net/core/rmem_max. Returns -1
+    // when the file is unavailable (non-Linux platforms).
+    static long read_kernel_limit(const char *path)
+    {
+        long value = -1;
+        std::ifstream limit_file(path);
+        if (limit_file.is_open()) {
+            limit_file >> value;
+        }
+        return value;
+    }
+
+    // Apply the programmatic discovery fast path: unicast initial peers so
+    // known nodes are contacted directly, optionally dropping multicast and
+    // unknown peers entirely, plus an initial announcement burst so peers
+    // that start a moment later still complete discovery within their first
+    // announcement window instead of the next multicast round.
+    void apply_discovery_fast_path(
+            dds::domain::qos::DomainParticipantQos &participant_qos,
+            const DiscoveryFastPath &discovery)
+    {
+        auto discovery_policy =
+                participant_qos.policy<rti::core::policy::Discovery>();
+
+        if (!discovery.initial_peers.empty()) {
+            discovery_policy.initial_peers(discovery.initial_peers);
+            if (discovery.peers_only) {
+                // Closed system: no multicast listener, no unknown peers
+                discovery_policy.multicast_receive_addresses(
+                        std::vector<std::string>());
+                discovery_policy.accept_unknown_peers(false);
+            }
+        }
+        participant_qos << discovery_policy;
+
+        if (discovery.initial_announcements > 0) {
+            auto discovery_config = participant_qos.policy<
+                    rti::core::policy::DiscoveryConfig>();
+            discovery_config.initial_participant_announcements(
+                    discovery.initial_announcements);
+            discovery_config.min_initial_participant_announcement_period(
+                    dds::core::Duration::from_millisecs(
+                            discovery.min_announcement_period_ms));
+            discovery_config.max_initial_participant_announcement_period(
+                    dds::core::Duration::from_millisecs(
+                            discovery.max_announcement_period_ms));
+            participant_qos << discovery_config;
+        }
+
+        std::cout << "Discovery fast path applied: "
+                  << discovery.initial_peers.size() << " initial peer(s)"
+                  << (discovery.peers_only ? " (peers only)" : "")
+                  << (discovery.initial_announcements > 0
+                              ? ", announcement burst of "
+                                        + std::to_string(
+                                                discovery.initial_announcements)
+                              : "")
+                  << std::endl;
+    }
+
+    // Apply transport property overrides sized for the declared workload:
+    //   - UDPv4 send/receive socket buffers large enough to absorb a 100 ms
+    //     burst at the expected rate (at least 4 samples deep)
+    //   - SHMEM segment large enough for one full sample, 4 messages deep
+    // The socket buffer request is checked against the kernel's
+    // rmem_max/wmem_max ceiling - the OS silently clamps setsockopt() above
+    // that, which is exactly the misconfiguration that produces sample_lost
+    // storms with multi-MB samples. We cannot raise the ceiling from user
+    // space, so it is reported loudly with a pointer to the fix.
+    void apply_transport_tuning(
+            dds::domain::qos::DomainParticipantQos &participant_qos,
+            const TransportWorkloadHint &workload)
+    {
+        // Samples arriving within one 100 ms scheduling hiccup must fit in
+        // the socket buffer, with a floor of 4 samples for low-rate flows
+        size_t samples_per_burst = workload.expected_rate_hz > 40
+                ? static_cast<size_t>(workload.expected_rate_hz) / 10
+                : 4;
+        size_t desired_socket_bytes =
+                workload.max_sample_size_bytes * samples_per_burst;
+
+        size_t recv_socket_bytes = desired_socket_bytes;
+        size_t send_socket_bytes = desired_socket_bytes;
+
+        long rmem_max = read_kernel_limit("/proc/sys/net/core/rmem_max");
+        long wmem_max = read_kernel_limit("/proc/sys/net/core/wmem_max");
+
+        if (rmem_max > 0
+            && desired_socket_bytes > static_cast<size_t>(rmem_max)) {
+            recv_socket_bytes = static_cast<size_t>(rmem_max);
+            std::cerr
+                    << "**********************************************************\n"
+                    << "* WARNING: kernel net.core.rmem_max (" << rmem_max
+                    << " bytes) is below\n"
+                    << "* the " << desired_socket_bytes
+                    << " bytes this workload needs. Receive socket\n"
+                    << "* buffers will be clamped by the OS - expect sample_lost\n"
+                    << "* storms under bursts. This cannot be fixed from user\n"
+                    << "* space: run tools/optimize_socket_buffers.sh (as root)\n"
+                    << "* to raise the kernel limits.\n"
+                    << "**********************************************************"
+                    << std::endl;
+        }
+        if (wmem_max > 0
+            && desired_socket_bytes > static_cast<size_t>(wmem_max)) {
+            send_socket_bytes = static_cast<size_t>(wmem_max);
+            std::cerr << "WARNING: kernel net.core.wmem_max (" << wmem_max
+                      << " bytes) is below the " << desired_socket_bytes
+                      << " bytes this workload needs; send socket buffers"
+                      << " will be clamped. Run"
+                      << " tools/optimize_socket_buffers.sh to raise it."
+                      << std::endl;
+        }
+
+        // SHMEM segment must hold one whole sample (plus protocol overhead)
+        // per message, a few messages deep
+        size_t shmem_message_size_max = workload.max_sample_size_bytes + 1024;
+        size_t shmem_receive_buffer_size = shmem_message_size_max * 4;
+
+        // Builtin transport properties override the values inherited from
+        // the XML profile for this participant only
+        auto property = participant_qos.policy<rti::core::policy::Property>();
+        property.set(
+                { "dds.transport.UDPv4.builtin.send_socket_buffer_size",
+                  std::to_string(send_socket_bytes) },
+                false);
+        property.set(
+                { "dds.transport.UDPv4.builtin.recv_socket_buffer_size",
+                  std::to_string(recv_socket_bytes) },
+                false);
+        property.set(
+                { "dds.transport.shmem.builtin.parent.message_size_max",
+                  std::to_string(shmem_message_size_max) },
+                false);
+        property.set(
+                { "dds.transport.shmem.builtin.receive_buffer_size",
+                  std::to_string(shmem_receive_buffer_size) },
+                false);
+        property.set(
+                { "dds.transport.shmem.builtin.received_message_count_max",
+                  "4" },
+                false);
+        participant_qos << property;
+
+        std::cout << "Transport tuning applied for "
+                  << workload.max_sample_size_bytes << " byte samples at "
+                  << workload.expected_rate_hz
+                  << " Hz: socket buffers send/recv = " << send_socket_bytes
+                  << "/" << recv_socket_bytes
+                  << " bytes, SHMEM message_size_max = "
+                  << shmem_message_size_max << " bytes" << std::endl;
+    }
 };
 
 #endif  // DDS_PARTICIPANT_SETUP
\ No newline at end of file
@@ -0,0 +1,294 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_PERF_TELEMETRY_HPP
+#define DDS_PERF_TELEMETRY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rti/rti.hpp>
+
+#include "ExampleTypes.hpp"
+#include "Definitions.hpp"
+#include "DDSParticipantSetup.hpp"
+
+/*
+ * DDSPerfTelemetry - hot-path performance counters for the DDS wrappers
+ *
+ * When an AsyncWaitSet lane saturates in the field there is nothing to look
+ * at: neither DDSReaderSetup nor DDSWriterSetup records timing. This header
+ * adds two pieces:
+ *
+ *   - DDSEntityCounters: one counter block per reader/writer, updated from
+ *     the dispatch path with relaxed atomics (an increment and a CAS max -
+ *     no locks, no allocation, ~tens of ns per dispatch). Readers record
+ *     dispatch count, samples per take, take duration and callback duration;
+ *     writers record write duration and FlatData loan wait time.
+ *
+ *   - DDSPerfTelemetry: process-wide registry of counter blocks. Once an
+ *     application calls enable_publishing(), a background thread snapshots
+ *     and resets every block each interval and publishes it as
+ *     example_types::EntityPerfCounters on the EntityPerfCounters topic
+ *     with the StatusQoS profile, so tools/rti_view can graph which of the
+ *     process's entities is eating the shared thread pool - no profiler
+ *     attachment needed.
+ *
+ * The wrappers register themselves at construction; instrumentation is
+ * always collected, and costs nothing visible until publishing is enabled.
+ */
+class DDSEntityCounters {
+public:
+    explicit DDSEntityCounters(const std::string &entity_name)
+            : _entity_name(entity_name)
+    {
+    }
+
+    // Reader path: one take of `samples` samples that took `usec`
+    void record_take(uint64_t samples, uint64_t usec)
+    {
+        _samples_taken.fetch_add(samples, std::memory_order_relaxed);
+        _take_usec_total.fetch_add(usec, std::memory_order_relaxed);
+        update_max(_take_usec_max, usec);
+        update_max(_samples_per_take_max, samples);
+    }
+
+    // Reader path: one condition dispatch whose application callback ran
+    // for `usec`
+    void record_callback(uint64_t usec)
+    {
+        _dispatch_count.fetch_add(1, std::memory_order_relaxed);
+        _callback_usec_total.fetch_add(usec, std::memory_order_relaxed);
+        update_max(_callback_usec_max, usec);
+    }
+
+    // Writer path: one write() that took `usec`
+    void record_write(uint64_t usec)
+    {
+        _write_count.fetch_add(1, std::memory_order_relaxed);
+        _write_usec_total.fetch_add(usec, std::memory_order_relaxed);
+        update_max(_write_usec_max, usec);
+    }
+
+    // Writer path: time spent acquiring a FlatData/Zero-Copy loan
+    void record_loan_wait(uint64_t usec)
+    {
+        _loan_wait_usec_total.fetch_add(usec, std::memory_order_relaxed);
+    }
+
+    // True if anything happened since the last snapshot (idle entities are
+    // not published)
+    bool active() const
+    {
+        return _dispatch_count.load(std::memory_order_relaxed) > 0
+                || _write_count.load(std::memory_order_relaxed) > 0;
+    }
+
+    // Move the interval's counters into the sample and reset them
+    void snapshot_and_reset(example_types::EntityPerfCounters &msg)
+    {
+        msg.entity_name(_entity_name);
+        msg.dispatch_count(_dispatch_count.exchange(0, std::memory_order_relaxed));
+        msg.samples_taken(_samples_taken.exchange(0, std::memory_order_relaxed));
+        msg.take_usec_total(_take_usec_total.exchange(0, std::memory_order_relaxed));
+        msg.take_usec_max(static_cast<uint32_t>(
+                _take_usec_max.exchange(0, std::memory_order_relaxed)));
+        msg.callback_usec_total(
+                _callback_usec_total.exchange(0, std::memory_order_relaxed));
+        msg.callback_usec_max(static_cast<uint32_t>(
+                _callback_usec_max.exchange(0, std::memory_order_relaxed)));
+        msg.samples_per_take_max(static_cast<uint32_t>(
+                _samples_per_take_max.exchange(0, std::memory_order_relaxed)));
+        msg.write_count(_write_count.exchange(0, std::memory_order_relaxed));
+        msg.write_usec_total(
+                _write_usec_total.exchange(0, std::memory_order_relaxed));
+        msg.write_usec_max(static_cast<uint32_t>(
+                _write_usec_max.exchange(0, std::memory_order_relaxed)));
+        msg.loan_wait_usec_total(
+                _loan_wait_usec_total.exchange(0, std::memory_order_relaxed));
+    }
+
+    const std::string &entity_name() const
+    {
+        return _entity_name;
+    }
+
+private:
+    // Lock-free running max (losing a race only costs one candidate)
+    static void update_max(std::atomic<uint64_t> &slot, uint64_t candidate)
+    {
+        uint64_t current = slot.load(std::memory_order_relaxed);
+        while (candidate > current
+               && !slot.compare_exchange_weak(
+                       current,
+                       candidate,
+                       std::memory_order_relaxed)) {
+        }
+    }
+
+    const std::string _entity_name;
+
+    std::atomic<uint64_t> _dispatch_count { 0 };
+    std::atomic<uint64_t> _samples_taken { 0 };
+    std::atomic<uint64_t> _take_usec_total { 0 };
+    std::atomic<uint64_t> _take_usec_max { 0 };
+    std::atomic<uint64_t> _callback_usec_total { 0 };
+    std::atomic<uint64_t> _callback_usec_max { 0 };
+    std::atomic<uint64_t> _samples_per_take_max { 0 };
+    std::atomic<uint64_t> _write_count { 0 };
+    std::atomic<uint64_t> _write_usec_total { 0 };
+    std::atomic<uint64_t> _write_usec_max { 0 };
+    std::atomic<uint64_t> _loan_wait_usec_total { 0 };
+};
+
+class DDSPerfTelemetry {
+public:
+    // Process-wide registry
+    static DDSPerfTelemetry &instance()
+    {
+        static DDSPerfTelemetry telemetry;
+        return telemetry;
+    }
+
+    // Called by the wrappers at construction; the returned block is what
+    // the dispatch path updates
+    std::shared_ptr<DDSEntityCounters> register_entity(
+            const std::string &entity_name)
+    {
+        std::lock_guard<std::mutex> lock(_registry_mutex);
+        auto counters = std::make_shared<DDSEntityCounters>(entity_name);
+        _entities.push_back(counters);
+        return counters;
+    }
+
+    // Start the periodic publisher. The writer uses the StatusQoS profile
+    // (best-effort, keep-last) on the EntityPerfCounters topic; one
+    // instance per entity, keyed by app_id + entity_name.
+    void enable_publishing(
+            std::shared_ptr<DDSParticipantSetup> participant_setup,
+            const std::string &app_id,
+            const int interval_msec = 1000)
+    {
+        std::lock_guard<std::mutex> lock(_registry_mutex);
+        if (_publisher_thread.joinable()) {
+            std::cout << "Perf telemetry publishing already enabled"
+                      << std::endl;
+            return;
+        }
+
+        try {
+            // Find-or-create the topic like the wrappers do
+            auto topic = dds::topic::find<
+                    dds::topic::Topic<example_types::EntityPerfCounters>>(
+                    participant_setup->participant(),
+                    topics::PERF_COUNTERS_TOPIC);
+            if (topic == dds::core::null) {
+                topic = dds::topic::Topic<example_types::EntityPerfCounters>(
+                        participant_setup->participant(),
+                        topics::PERF_COUNTERS_TOPIC);
+            }
+
+            _perf_writer =
+                    dds::pub::DataWriter<example_types::EntityPerfCounters>(
+                            topic,
+                            participant_setup->datawriter_qos(
+                                    qos_profiles::STATUS,
+                                    topics::PERF_COUNTERS_TOPIC));
+        } catch (const std::exception &e) {
+            std::cerr << "Failed to create perf telemetry writer: " << e.what()
+                      << std::endl;
+            return;
+        }
+
+        _app_id = app_id;
+        _interval_msec = interval_msec;
+        _shutdown.store(false);
+        _publisher_thread = std::thread([this] { publish_loop(); });
+
+        std::cout << "Perf telemetry publishing every " << interval_msec
+                  << " ms on topic " << topics::PERF_COUNTERS_TOPIC
+                  << std::endl;
+    }
+
+    // Stop the periodic publisher. Call before the participant is
+    // destroyed when publishing was enabled.
+    void disable_publishing()
+    {
+        _shutdown.store(true);
+        if (_publisher_thread.joinable()) {
+            _publisher_thread.join();
+        }
+        _perf_writer = dds::core::null;
+    }
+
+    ~DDSPerfTelemetry()
+    {
+        disable_publishing();
+    }
+
+private:
+    DDSPerfTelemetry() = default;
+    DDSPerfTelemetry(const DDSPerfTelemetry &) = delete;
+    DDSPerfTelemetry &operator=(const DDSPerfTelemetry &) = delete;
+
+    // Snapshot-and-publish loop; one sample per active entity per interval
+    void publish_loop()
+    {
+        example_types::EntityPerfCounters msg;
+        msg.app_id(_app_id);
+        msg.interval_msec(static_cast<uint32_t>(_interval_msec));
+
+        while (!_shutdown.load()) {
+            std::this_thread::sleep_for(
+                    std::chrono::milliseconds(_interval_msec));
+
+            std::vector<std::shared_ptr<DDSEntityCounters>> entities;
+            {
+                std::lock_guard<std::mutex> lock(_registry_mutex);
+                entities = _entities;
+            }
+
+            for (auto &entity : entities) {
+                if (!entity->active()) {
+                    continue;
+                }
+                entity->snapshot_and_reset(msg);
+                try {
+                    _perf_writer.write(msg);
+                } catch (const std::exception &e) {
+                    std::cerr << "Error publishing perf counters for "
+                              << entity->entity_name() << ": " << e.what()
+                              << std::endl;
+                }
+            }
+        }
+    }
+
+    std::mutex _registry_mutex;
+    std::vector<std::shared_ptr<DDSEntityCounters>> _entities;
+
+    dds::pub::DataWriter<example_types::EntityPerfCounters> _perf_writer =
+            dds::core::null;
+    std::string _app_id;
+    int _interval_msec = 1000;
+    std::atomic<bool> _shutdown { false };
+    std::thread _publisher_thread;
+};
+
+#endif  // DDS_PERF_TELEMETRY_HPP
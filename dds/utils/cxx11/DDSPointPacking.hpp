@@ -0,0 +1,191 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_POINT_PACKING_HPP
+#define DDS_POINT_PACKING_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+/*
+ * Point Packing Kernels
+ *
+ * Converts structure-of-arrays float channels (x[], y[], z[], optional
+ * intensity[]) into the interleaved little-endian byte layout described by
+ * foxglove::PackedElementField in one pass:
+ *   - pack_xyz:  12-byte stride, FLOAT32 x/y/z at offsets 0/4/8
+ *   - pack_xyzi: 16-byte stride, FLOAT32 x/y/z/intensity at offsets 0/4/8/12
+ *
+ * The kernel is selected at build time from the compiler's target flags:
+ *   - SSE2 (and AVX2 builds): 4x4 register transpose, 4 points per iteration.
+ *     AVX2 builds reuse the 4-wide kernel - the 12-byte stride does not
+ *     reward wider shuffles
+ *   - NEON: structured stores (vst3q/vst4q) interleave 4 points per iteration
+ *   - Scalar fallback: per-field memcpy, identical output
+ *
+ * All variants produce byte-identical buffers, so the selection is purely a
+ * throughput concern. Used by the foxglove pointcloud/rawimage apps, which
+ * generate their channels SoA and pack once per frame.
+ */
+
+#if defined(__SSE2__) || defined(__AVX2__) \
+        || (defined(_M_X64) && !defined(_M_ARM64EC))
+    #include <emmintrin.h>
+    #include <xmmintrin.h>
+    #define DDS_POINT_PACKING_SSE 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DDS_POINT_PACKING_NEON 1
+#endif
+
+namespace point_packing {
+
+// Name of the kernel compiled in - handy for benchmark/report output
+inline const char *instruction_set()
+{
+#if defined(DDS_POINT_PACKING_SSE)
+    return "SSE2";
+#elif defined(DDS_POINT_PACKING_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+// Scalar reference: one point per iteration, per-field memcpy. Also used as
+// the tail loop by the vector kernels.
+inline void pack_xyz_scalar(
+        const float *x,
+        const float *y,
+        const float *z,
+        size_t begin,
+        size_t count,
+        uint8_t *dest)
+{
+    for (size_t i = begin; i < count; i++) {
+        uint8_t *point = dest + i * 12;
+        std::memcpy(point, x + i, sizeof(float));
+        std::memcpy(point + 4, y + i, sizeof(float));
+        std::memcpy(point + 8, z + i, sizeof(float));
+    }
+}
+
+inline void pack_xyzi_scalar(
+        const float *x,
+        const float *y,
+        const float *z,
+        const float *intensity,
+        size_t begin,
+        size_t count,
+        uint8_t *dest)
+{
+    for (size_t i = begin; i < count; i++) {
+        uint8_t *point = dest + i * 16;
+        std::memcpy(point, x + i, sizeof(float));
+        std::memcpy(point + 4, y + i, sizeof(float));
+        std::memcpy(point + 8, z + i, sizeof(float));
+        std::memcpy(point + 12, intensity + i, sizeof(float));
+    }
+}
+
+// Interleave x/y/z channels into dest with a 12-byte point stride.
+// dest must hold count * 12 bytes.
+inline void pack_xyz(
+        const float *x,
+        const float *y,
+        const float *z,
+        size_t count,
+        uint8_t *dest)
+{
+    size_t i = 0;
+
+#if defined(DDS_POINT_PACKING_SSE)
+    // Transpose 4 channel registers into 4 point registers and store each
+    // with a 16-byte store at a 12-byte stride. The trailing 4 junk bytes of
+    // every store are overwritten by the next point, so the loop stops one
+    // group early and leaves the last points to the scalar tail.
+    if (count >= 8) {
+        for (; i + 8 <= count; i += 4) {
+            __m128 vx = _mm_loadu_ps(x + i);
+            __m128 vy = _mm_loadu_ps(y + i);
+            __m128 vz = _mm_loadu_ps(z + i);
+            __m128 vw = vx;  // dummy lane, never read back
+            _MM_TRANSPOSE4_PS(vx, vy, vz, vw);
+
+            float *out = reinterpret_cast<float *>(dest + i * 12);
+            _mm_storeu_ps(out, vx);
+            _mm_storeu_ps(out + 3, vy);
+            _mm_storeu_ps(out + 6, vz);
+            _mm_storeu_ps(out + 9, vw);
+        }
+    }
+#elif defined(DDS_POINT_PACKING_NEON)
+    // vst3q interleaves three channel registers directly: exactly 4 points
+    // (48 bytes) per store, no overlap
+    for (; i + 4 <= count; i += 4) {
+        float32x4x3_t points;
+        points.val[0] = vld1q_f32(x + i);
+        points.val[1] = vld1q_f32(y + i);
+        points.val[2] = vld1q_f32(z + i);
+        vst3q_f32(reinterpret_cast<float *>(dest + i * 12), points);
+    }
+#endif
+
+    pack_xyz_scalar(x, y, z, i, count, dest);
+}
+
+// Interleave x/y/z/intensity channels into dest with a 16-byte point stride.
+// dest must hold count * 16 bytes.
+inline void pack_xyzi(
+        const float *x,
+        const float *y,
+        const float *z,
+        const float *intensity,
+        size_t count,
+        uint8_t *dest)
+{
+    size_t i = 0;
+
+#if defined(DDS_POINT_PACKING_SSE)
+    // 16-byte stride means every transposed point register maps to exactly
+    // one store - no overlap, no early stop
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+        __m128 vw = _mm_loadu_ps(intensity + i);
+        _MM_TRANSPOSE4_PS(vx, vy, vz, vw);
+
+        float *out = reinterpret_cast<float *>(dest + i * 16);
+        _mm_storeu_ps(out, vx);
+        _mm_storeu_ps(out + 4, vy);
+        _mm_storeu_ps(out + 8, vz);
+        _mm_storeu_ps(out + 12, vw);
+    }
+#elif defined(DDS_POINT_PACKING_NEON)
+    for (; i + 4 <= count; i += 4) {
+        float32x4x4_t points;
+        points.val[0] = vld1q_f32(x + i);
+        points.val[1] = vld1q_f32(y + i);
+        points.val[2] = vld1q_f32(z + i);
+        points.val[3] = vld1q_f32(intensity + i);
+        vst4q_f32(reinterpret_cast<float *>(dest + i * 16), points);
+    }
+#endif
+
+    pack_xyzi_scalar(x, y, z, intensity, i, count, dest);
+}
+
+}  // namespace point_packing
+
+#endif  // DDS_POINT_PACKING_HPP
@@ -16,10 +16,21 @@
 #include <rti/rti.hpp>  // Include necessary DDS headers
 #include <rti/core/cond/AsyncWaitSet.hpp>
 #include <string>      // Include string header
+#include <vector>
+#include <chrono>
 #include <iostream>
 #include <functional>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
 
+#include "DDSAsyncLogger.hpp"
+#include "DDSCoroutineExecutor.hpp"
 #include "DDSParticipantSetup.hpp"
+#include "DDSPerfTelemetry.hpp"
+#include "DDSTopicRegistry.hpp"
 
 using namespace rti::all;
 
@@ -30,6 +41,8 @@ using namespace rti::all;
  *   - DataReader: Subscribes to messages on a specified topic with configurable QoS
  *   - Status Callbacks: Supports multiple DDS event callbacks including:
  *       * data_available: Fires when new data is available to read
+ *       * loaned_batch: Alternative data path where the wrapper takes loaned
+ *                       samples itself and dispatches the whole batch zero-copy
  *       * subscription_matched: Fires when writers matching the subscription are discovered
  *       * liveliness_changed: Fires when writer liveliness status changes
  *       * requested_deadline_missed: Fires when expected data deadline is missed
@@ -39,6 +52,43 @@ using namespace rti::all;
  *   - AsyncWaitSet Integration: Registers status conditions with the centralized AsyncWaitSet
  *                                allowing all status events to be processed asynchronously via
  *                                thread pool without blocking the application
+ *   - Content Filtering: An optional filter expression + parameters creates a
+ *                        ContentFilteredTopic under the hood so filtering runs
+ *                        writer-side in the middleware instead of in the
+ *                        application; set_filter_parameters() re-targets the
+ *                        filter at runtime without entity teardown
+ *   - Instance Dispatch: For keyed topics, per-instance handlers registered
+ *                        by key value are routed directly via a hash index
+ *                        from instance handle to handler - the wrapper takes
+ *                        each instance's batch with select().instance() and
+ *                        invokes only that instance's handler, instead of the
+ *                        application scanning every sample and branching on
+ *                        key; instance appearance/disposal fire lifecycle
+ *                        callbacks
+ *   - Decimation: The decimating constructor turns a requested max delivery
+ *                 rate into TIME_BASED_FILTER QoS (minimum_separation =
+ *                 1/max_rate), so the middleware drops intermediate samples
+ *                 before delivery - a 10 Hz view of a 500 Hz topic costs 10
+ *                 wakeups and takes per second, not 500. For flows the filter
+ *                 cannot thin middleware-side (QoS-incompatible writers,
+ *                 writer-side batches arriving as one submessage), the
+ *                 keep-1-in-N fallback decimates in the dispatch path before
+ *                 the application sees the samples
+ *   - Coroutine Read API (C++20 targets only): co_await next_sample() /
+ *                 next_batch() suspends on the reader's ReadCondition and
+ *                 resumes with a loaned batch, driven by a single-threaded
+ *                 DDSCoroutineExecutor - sequential multi-topic logic
+ *                 without handler mutexes or pool wakeups
+ *
+ * Default status handlers log through DDSAsyncLogger rather than writing to
+ * std::cout directly: they run on AsyncWaitSet pool threads, and a status
+ * storm (e.g. sample_lost per missed batch) must not serialize the pool on
+ * the iostream lock.
+ *
+ * Every dispatch path feeds a per-reader DDSEntityCounters block (dispatch
+ * count, samples per take, take and callback durations) registered with
+ * DDSPerfTelemetry, so the counters can be published on the
+ * EntityPerfCounters topic and graphed with tools/rti_view.
  */
 template <typename T>
 class DDSReaderSetup {
@@ -47,6 +97,29 @@ public:
     using DataProcessingFunction =
             std::function<void(dds::sub::DataReader<T> &)>;
 
+    // Define function type for loaned batch processing callback.
+    // The wrapper performs the take internally and hands the application the
+    // loaned samples directly - no per-sample copy is made. The loans are
+    // returned to the middleware when the callback returns.
+    using LoanedBatchFunction =
+            std::function<void(rti::sub::LoanedSamples<T> &)>;
+
+    // Define function type for per-instance batch processing. The wrapper
+    // hands the handler the loaned samples of exactly one instance.
+    using InstanceBatchFunction =
+            std::function<void(rti::sub::LoanedSamples<T> &)>;
+
+    // Define function type for instance lifecycle callbacks (instance
+    // appeared / instance disposed or unregistered)
+    using InstanceLifecycleFunction =
+            std::function<void(const dds::core::InstanceHandle &)>;
+
+    // Define function type for decimated per-sample delivery. The wrapper
+    // takes every sample (freeing middleware queue resources) but only
+    // invokes the handler for the kept ones.
+    using DecimatedSampleFunction =
+            std::function<void(const dds::sub::Sample<T> &)>;
+
     // Define function type for subscription matched callback
     using SubscriptionMatchedFunction =
             std::function<void(dds::sub::DataReader<T> &)>;
@@ -67,41 +140,34 @@ public:
     using SampleRejectedFunction =
             std::function<void(dds::sub::DataReader<T> &)>;
 
-    // Constructor accepting a DDSParticipantSetup for Reader setup
+    // Constructor accepting a DDSParticipantSetup for Reader setup.
+    // waitset_lane selects a named AsyncWaitSet lane created via
+    // DDSParticipantSetup::add_waitset_lane; empty selects the default lane.
     explicit DDSReaderSetup(
             std::shared_ptr<DDSParticipantSetup> &p_setup,
             const std::string &topic_name,
-            const std::string &qos_profile = "")
-            : _participant(p_setup->participant()),
-              _async_waitset(p_setup->async_waitset()),
+            const std::string &qos_profile = "",
+            const std::string &waitset_lane = "")
+            : _participant_setup(p_setup),
+              _participant(p_setup->participant()),
+              _async_waitset(p_setup->async_waitset(waitset_lane)),
               _topic_name(topic_name),
               _qos_file(p_setup->qos_file_path()),
               _qos_profile(qos_profile)
     {
         std::cout << "Created DDS Reader Setup Class" << std::endl;
 
-        if (!_qos_file.empty()) {
-            _qos_provider = dds::core::QosProvider(_qos_file);
-        }
-
-        // If Topic not already created, create new
-        _topic = dds::topic::find<dds::topic::Topic<T>>(
-                _participant,
-                _topic_name);
-        if (_topic == dds::core::null) {
-            _topic = dds::topic::Topic<T>(_participant, _topic_name);
-        } else {
-            std::cout << "Topic " << _topic_name << " already created"
-                      << std::endl;
-        }
+        init_topic();
 
         // Create DataReader
         std::cout << "Creating Reader..." << std::endl;
 
         if (!_qos_file.empty() && !_qos_profile.empty()) {
+            // QoS comes from the participant setup's shared, memoized provider
+            // so the XML file is not re-parsed per entity
             _reader = dds::sub::DataReader<T>(
                     _topic,
-                    _qos_provider.extensions().datareader_qos_w_topic_name(
+                    _participant_setup->datareader_qos(
                             _qos_profile,
                             _topic_name));
 
@@ -113,36 +179,154 @@ public:
                       << " with default QoS." << std::endl;
         }
 
-        // Setup default status handler directly
-        if (_reader != dds::core::null) {
-            std::cout << "Setting up status condition for " << _topic_name << std::endl;
-            _status_condition = dds::core::cond::StatusCondition(_reader);
-            
-            // Enable subscription matched status
-            _status_condition.enabled_statuses(
-                dds::core::status::StatusMask::subscription_matched()
-                | dds::core::status::StatusMask::liveliness_changed()
-                | dds::core::status::StatusMask::requested_deadline_missed()
-                | dds::core::status::StatusMask::requested_incompatible_qos()
-                | dds::core::status::StatusMask::sample_lost()
-                | dds::core::status::StatusMask::sample_rejected());
-            
-            // Attach handler directly - on_status_triggered will dispatch
-            _status_condition->handler([this](dds::core::cond::Condition) {
-                on_status_triggered();
-            });
-            
-            // Attach to AsyncWaitSet
-            try {
-                _async_waitset.attach_condition(_status_condition);
-                std::cout << "Attached status condition to AsyncWaitset for " << _topic_name << std::endl;
-            } catch (const std::exception &e) {
-                std::cerr << "Error attaching status condition: " << e.what() << std::endl;
+        init_status_condition();
+    }
+
+    // Registry constructor: resolves topic name and default QoS profile
+    // from the compile-time table in DDSTopicRegistry.hpp, so an unknown
+    // topic or misspelled profile is a compile error rather than a
+    // runtime entity-creation failure
+    explicit DDSReaderSetup(
+            std::shared_ptr<DDSParticipantSetup> &p_setup,
+            topic_registry::TopicId topic,
+            const std::string &waitset_lane = "")
+            : DDSReaderSetup(
+                    p_setup,
+                    topic_registry::name(topic),
+                    topic_registry::default_qos_profile(topic),
+                    waitset_lane)
+    {
+    }
+
+    // Content-filtered constructor: subscribes through a ContentFilteredTopic
+    // built from filter_expression/filter_parameters (e.g. "destination_id =
+    // %0" with {"'node_7'"}), so samples addressed elsewhere are dropped by
+    // the middleware - writer-side where the transport supports it - instead
+    // of being deserialized and discarded by the application.
+    explicit DDSReaderSetup(
+            std::shared_ptr<DDSParticipantSetup> &p_setup,
+            const std::string &topic_name,
+            const std::string &qos_profile,
+            const std::string &filter_expression,
+            const std::vector<std::string> &filter_parameters,
+            const std::string &waitset_lane = "")
+            : _participant_setup(p_setup),
+              _participant(p_setup->participant()),
+              _async_waitset(p_setup->async_waitset(waitset_lane)),
+              _topic_name(topic_name),
+              _qos_file(p_setup->qos_file_path()),
+              _qos_profile(qos_profile)
+    {
+        std::cout << "Created DDS Reader Setup Class (content filtered)"
+                  << std::endl;
+
+        init_topic();
+
+        // Create the ContentFilteredTopic on top of the plain topic
+        dds::topic::Filter filter(filter_expression, filter_parameters);
+        _content_filtered_topic = dds::topic::ContentFilteredTopic<T>(
+                _topic,
+                _topic_name + "_CFT",
+                filter);
+        std::cout << "ContentFilteredTopic on " << _topic_name << ": "
+                  << filter_expression << std::endl;
+
+        // Create DataReader on the CFT (explicit Subscriber - the CFT
+        // constructors require one, matching DDSServerParameterSetup)
+        std::cout << "Creating Reader..." << std::endl;
+        dds::sub::Subscriber subscriber(_participant);
+
+        if (!_qos_file.empty() && !_qos_profile.empty()) {
+            _reader = dds::sub::DataReader<T>(
+                    subscriber,
+                    _content_filtered_topic,
+                    _participant_setup->datareader_qos(
+                            _qos_profile,
+                            _topic_name));
+
+            std::cout << "DataReader created on filtered topic: " << _topic_name
+                      << " with QoS profile: " << _qos_profile << std::endl;
+        } else {
+            _reader = dds::sub::DataReader<T>(
+                    subscriber,
+                    _content_filtered_topic);
+            std::cout << "DataReader created on filtered topic: " << _topic_name
+                      << " with default QoS." << std::endl;
+        }
+
+        init_status_condition();
+    }
+
+    // Decimating constructor: subsamples a high-rate topic down to
+    // max_rate_hz. The rate is expressed as TIME_BASED_FILTER QoS
+    // (minimum_separation = 1/max_rate_hz) so samples inside the separation
+    // window are dropped by the middleware before delivery - no wakeup, no
+    // take, no deserialization for them. fallback_keep_one_in_n (0 = off)
+    // additionally arms application-level decimation for
+    // set_decimated_sample_handler, covering writers the filter cannot thin
+    // middleware-side.
+    explicit DDSReaderSetup(
+            std::shared_ptr<DDSParticipantSetup> &p_setup,
+            const std::string &topic_name,
+            const std::string &qos_profile,
+            double max_rate_hz,
+            size_t fallback_keep_one_in_n = 0,
+            const std::string &waitset_lane = "")
+            : _participant_setup(p_setup),
+              _participant(p_setup->participant()),
+              _async_waitset(p_setup->async_waitset(waitset_lane)),
+              _topic_name(topic_name),
+              _qos_file(p_setup->qos_file_path()),
+              _qos_profile(qos_profile),
+              _decimation_keep_one_in_n(fallback_keep_one_in_n)
+    {
+        std::cout << "Created DDS Reader Setup Class (decimating to "
+                  << max_rate_hz << " Hz)" << std::endl;
+
+        init_topic();
+
+        // Create DataReader with the time-based filter layered on top of
+        // the profile QoS
+        std::cout << "Creating Reader..." << std::endl;
+
+        dds::sub::qos::DataReaderQos reader_qos;
+        if (!_qos_file.empty() && !_qos_profile.empty()) {
+            reader_qos = _participant_setup->datareader_qos(
+                    _qos_profile,
+                    _topic_name);
+        }
+
+        if (max_rate_hz > 0) {
+            // Nanosecond resolution: a millisecond Duration truncates to
+            // 0 for rates above 1 kHz, silently disabling the filter.
+            // Rates above 1 GHz are beyond what the filter can express
+            // and are treated as uncapped.
+            const int64_t separation_ns =
+                    static_cast<int64_t>(1e9 / max_rate_hz);
+            if (separation_ns > 0) {
+                reader_qos << dds::core::policy::TimeBasedFilter(
+                        dds::core::Duration::from_nanosecs(separation_ns));
+            } else {
+                std::cerr << "Warning: decimation rate " << max_rate_hz
+                          << " Hz is above TIME_BASED_FILTER resolution; "
+                             "no middleware-side filtering applied"
+                          << std::endl;
             }
-            
-            // Start the AsyncWaitSet
-            _async_waitset.start();
         }
+
+        _reader = dds::sub::DataReader<T>(_topic, reader_qos);
+
+        std::cout << "DataReader created on topic: " << _topic_name
+                  << " decimated to " << max_rate_hz << " Hz"
+                  << (_decimation_keep_one_in_n > 1
+                              ? " (keep-1-in-"
+                                        + std::to_string(
+                                                _decimation_keep_one_in_n)
+                                        + " fallback armed)"
+                              : "")
+                  << std::endl;
+
+        init_status_condition();
     }
 
     // Destructor - detach conditions from AsyncWaitSet
@@ -212,7 +396,9 @@ public:
 
         // Add the registered handler to be triggered when new data comes in
         _read_condition->handler([this](dds::core::cond::Condition) {
+            const auto start = std::chrono::steady_clock::now();
             _custom_data_handler(_reader);
+            _perf_counters->record_callback(elapsed_usec(start));
         });
 
         // Attach condition to AsyncWaitSet
@@ -230,6 +416,309 @@ public:
         _async_waitset.start();
     }
 
+    // Set batch handler and attach read condition with NOT_READ state to
+    // AsyncWaitSet. Unlike set_data_available_handler, the wrapper performs
+    // the take itself and passes the loaned samples straight through, so the
+    // application processes a whole batch per condition trigger without
+    // copying samples out of the middleware queue. max_batch bounds how many
+    // samples are taken per dispatch (0 = take everything available).
+    void set_loaned_batch_handler(LoanedBatchFunction handler, size_t max_batch = 0)
+    {
+        if (!handler) {
+            std::cerr << "Error: No batch handler provided" << std::endl;
+            return;
+        }
+
+        _loaned_batch_handler = handler;
+        _max_batch_size = max_batch;
+        std::cout << "Setting loaned batch handler for " << _topic_name << std::endl;
+
+        // Detach old read condition if it exists
+        if (_read_condition != dds::core::null) {
+            try {
+                _async_waitset.detach_condition(_read_condition);
+                std::cout << "Detached previous read condition\n";
+            } catch (const std::exception &e) {
+                std::cerr << "Error detaching previous read condition: " << e.what() << std::endl;
+            }
+        }
+
+        // Create read condition with NOT_READ sample state
+        if (_reader != dds::core::null) {
+            _read_condition = dds::sub::cond::ReadCondition(
+                _reader,
+                dds::sub::status::DataState(
+                    dds::sub::status::SampleState::not_read(),
+                    dds::sub::status::ViewState::any(),
+                    dds::sub::status::InstanceState::any()
+                )
+            );
+        } else {
+            std::cerr << "Error: Reader is null, cannot create ReadCondition" << std::endl;
+            return;
+        }
+
+        // Take the loans inside the wrapper and hand the whole batch to the
+        // application. The LoanedSamples destructor returns the loans once
+        // the handler is done with the batch.
+        _read_condition->handler([this](dds::core::cond::Condition) {
+            const auto take_start = std::chrono::steady_clock::now();
+            auto samples = (_max_batch_size > 0)
+                    ? _reader.select()
+                              .max_samples(static_cast<int32_t>(_max_batch_size))
+                              .take()
+                    : _reader.take();
+            _perf_counters->record_take(
+                    samples.length(),
+                    elapsed_usec(take_start));
+            if (samples.length() > 0) {
+                const auto callback_start = std::chrono::steady_clock::now();
+                _loaned_batch_handler(samples);
+                _perf_counters->record_callback(elapsed_usec(callback_start));
+            }
+        });
+
+        // Attach condition to AsyncWaitSet
+        try {
+            _async_waitset.attach_condition(_read_condition);
+        } catch (const std::exception &e) {
+            std::cerr << "Error attaching read condition: " << e.what() << '\n';
+            return;
+        }
+
+        std::cout << "Loaned batch handler configured for " << _topic_name << std::endl;
+
+        // Start - returns true if already started
+        _async_waitset.start();
+    }
+
+    // Set a decimated per-sample handler. The wrapper takes every available
+    // sample (so the middleware queue drains at full rate) and invokes the
+    // handler for one sample in N when the keep-1-in-N fallback is armed
+    // (fallback_keep_one_in_n > 1 in the decimating constructor); with the
+    // fallback off every valid sample is delivered - the time-based filter
+    // has already thinned the flow middleware-side. Replaces any data/batch
+    // handler previously set on this reader.
+    void set_decimated_sample_handler(DecimatedSampleFunction handler)
+    {
+        if (!handler) {
+            std::cerr << "Error: No decimated sample handler provided" << std::endl;
+            return;
+        }
+
+        _decimated_sample_handler = handler;
+        std::cout << "Setting decimated sample handler for " << _topic_name << std::endl;
+
+        // Detach old read condition if it exists
+        if (_read_condition != dds::core::null) {
+            try {
+                _async_waitset.detach_condition(_read_condition);
+                std::cout << "Detached previous read condition\n";
+            } catch (const std::exception &e) {
+                std::cerr << "Error detaching previous read condition: " << e.what() << std::endl;
+            }
+        }
+
+        // Create read condition with NOT_READ sample state
+        if (_reader != dds::core::null) {
+            _read_condition = dds::sub::cond::ReadCondition(
+                _reader,
+                dds::sub::status::DataState(
+                    dds::sub::status::SampleState::not_read(),
+                    dds::sub::status::ViewState::any(),
+                    dds::sub::status::InstanceState::any()
+                )
+            );
+        } else {
+            std::cerr << "Error: Reader is null, cannot create ReadCondition" << std::endl;
+            return;
+        }
+
+        // Take everything, deliver one valid sample in N. The counter only
+        // runs on this reader's condition handler, so no synchronization is
+        // needed.
+        _read_condition->handler([this](dds::core::cond::Condition) {
+            const auto take_start = std::chrono::steady_clock::now();
+            auto samples = _reader.take();
+            _perf_counters->record_take(
+                    samples.length(),
+                    elapsed_usec(take_start));
+            const auto callback_start = std::chrono::steady_clock::now();
+            for (const auto &sample : samples) {
+                if (!sample.info().valid()) {
+                    continue;
+                }
+                if (_decimation_keep_one_in_n > 1
+                    && (_decimation_counter++ % _decimation_keep_one_in_n)
+                            != 0) {
+                    continue;  // dropped by the keep-1-in-N fallback
+                }
+                _decimated_sample_handler(sample);
+            }
+            _perf_counters->record_callback(elapsed_usec(callback_start));
+        });
+
+        // Attach condition to AsyncWaitSet
+        try {
+            _async_waitset.attach_condition(_read_condition);
+        } catch (const std::exception &e) {
+            std::cerr << "Error attaching read condition: " << e.what() << '\n';
+            return;
+        }
+
+        std::cout << "Decimated sample handler configured for " << _topic_name << std::endl;
+
+        // Start - returns true if already started
+        _async_waitset.start();
+    }
+
+    // Enable instance-aware dispatch on a keyed topic. Per condition trigger
+    // the wrapper takes samples instance by instance (select().instance())
+    // and routes each instance's batch straight to the handler registered for
+    // it via register_instance_handler; default_handler (optional) receives
+    // batches of instances nobody registered for. Replaces any data/batch
+    // handler previously set on this reader.
+    void set_instance_dispatch_handler(InstanceBatchFunction default_handler = nullptr)
+    {
+        _instance_default_handler = default_handler;
+        std::cout << "Setting instance dispatch handler for " << _topic_name << std::endl;
+
+        // Detach old read condition if it exists
+        if (_read_condition != dds::core::null) {
+            try {
+                _async_waitset.detach_condition(_read_condition);
+                std::cout << "Detached previous read condition\n";
+            } catch (const std::exception &e) {
+                std::cerr << "Error detaching previous read condition: " << e.what() << std::endl;
+            }
+        }
+
+        // Create read condition with NOT_READ sample state
+        if (_reader != dds::core::null) {
+            _read_condition = dds::sub::cond::ReadCondition(
+                _reader,
+                dds::sub::status::DataState(
+                    dds::sub::status::SampleState::not_read(),
+                    dds::sub::status::ViewState::any(),
+                    dds::sub::status::InstanceState::any()
+                )
+            );
+        } else {
+            std::cerr << "Error: Reader is null, cannot create ReadCondition" << std::endl;
+            return;
+        }
+
+        _read_condition->handler([this](dds::core::cond::Condition) {
+            dispatch_by_instance();
+        });
+
+        // Attach condition to AsyncWaitSet
+        try {
+            _async_waitset.attach_condition(_read_condition);
+        } catch (const std::exception &e) {
+            std::cerr << "Error attaching read condition: " << e.what() << '\n';
+            return;
+        }
+
+        std::cout << "Instance dispatch configured for " << _topic_name << std::endl;
+
+        // Start - returns true if already started
+        _async_waitset.start();
+    }
+
+    // Register a handler for one key value. key_holder carries the key
+    // fields of the instance (non-key fields are ignored). If the instance
+    // is not known to the reader yet, the registration is kept pending and
+    // resolved when the instance first appears.
+    void register_instance_handler(const T &key_holder, InstanceBatchFunction handler)
+    {
+        if (!handler) {
+            std::cerr << "Error: No instance handler provided" << std::endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_instance_mutex);
+        auto handle = _reader.lookup_instance(key_holder);
+        if (handle.is_nil()) {
+            // Instance not seen yet - resolved in dispatch_by_instance when
+            // the first sample of the instance arrives
+            _pending_instance_handlers.emplace_back(key_holder, handler);
+        } else {
+            _instance_handlers[handle] = handler;
+        }
+    }
+
+    // Drop the handler for one key value; its samples fall back to the
+    // default handler (if any)
+    void unregister_instance_handler(const T &key_holder)
+    {
+        std::lock_guard<std::mutex> lock(_instance_mutex);
+        auto handle = _reader.lookup_instance(key_holder);
+        if (!handle.is_nil()) {
+            _instance_handlers.erase(handle);
+        }
+    }
+
+    // Lifecycle callback: a new instance appeared on the topic (fired after
+    // any pending registration for it has been resolved)
+    void set_instance_registered_handler(InstanceLifecycleFunction handler)
+    {
+        _instance_registered_callback = handler;
+    }
+
+    // Lifecycle callback: an instance was disposed or unregistered by all
+    // its writers (fired after its batch was dispatched; the hash index
+    // entry is removed)
+    void set_instance_unregistered_handler(InstanceLifecycleFunction handler)
+    {
+        _instance_unregistered_callback = handler;
+    }
+
+    // Waitable that completes once at least `count` DataWriters are matched.
+    // Mirror of DDSWriterSetup::match_future, driven by the
+    // subscription_matched status condition; compose with
+    // match_utils::all_of to block once for the whole entity graph.
+    std::shared_future<void> match_future(int count)
+    {
+        if (count <= 0) {
+            throw std::invalid_argument(
+                    "Error: match count must be greater than 0");
+        }
+
+        std::lock_guard<std::mutex> lock(_match_mutex);
+        std::promise<void> promise;
+        auto future = promise.get_future().share();
+        if (_reader.subscription_matched_status().current_count() >= count) {
+            promise.set_value();  // already wired
+        } else {
+            _match_promises.emplace_back(count, std::move(promise));
+        }
+        return future;
+    }
+
+    // Re-target the content filter at runtime (e.g. follow a new node id)
+    // without tearing down the reader. Only valid for readers created with
+    // the content-filtered constructor.
+    void set_filter_parameters(const std::vector<std::string> &filter_parameters)
+    {
+        if (_content_filtered_topic == dds::core::null) {
+            std::cerr << "Error: Reader on " << _topic_name
+                      << " was not created with a content filter" << std::endl;
+            return;
+        }
+
+        try {
+            _content_filtered_topic.filter_parameters(
+                    filter_parameters.begin(),
+                    filter_parameters.end());
+            std::cout << "Updated filter parameters for " << _topic_name
+                      << std::endl;
+        } catch (const std::exception &e) {
+            std::cerr << "Error updating filter parameters: " << e.what()
+                      << std::endl;
+        }
+    }
+
     // Set handler for subscription matched events
     void set_subscription_matched_handler(SubscriptionMatchedFunction handler)
     {
@@ -304,6 +793,75 @@ public:
         _sample_rejected_callback = handler;
     }
 
+#if defined(DDS_UTILS_HAS_COROUTINES)
+    // Awaitable behind next_sample()/next_batch(): co_await parks the
+    // coroutine on a one-shot ReadCondition owned by the executor and
+    // resumes with the loaned batch once data arrives. The take happens
+    // in await_resume, so a wakeup that raced another consumer simply
+    // yields an empty batch instead of blocking.
+    class ReadAwaitable {
+    public:
+        ReadAwaitable(
+                dds::sub::DataReader<T> reader,
+                DDSCoroutineExecutor &executor,
+                size_t max_samples)
+                : _reader(reader),
+                _executor(executor),
+                _max_samples(max_samples)
+        {
+        }
+
+        bool await_ready()
+        {
+            // Skip the suspension entirely if data is already queued
+            return _reader->datareader_cache_status().sample_count() > 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            _executor.await_condition(
+                    dds::sub::cond::ReadCondition(
+                            _reader,
+                            dds::sub::status::DataState(
+                                    dds::sub::status::SampleState::not_read(),
+                                    dds::sub::status::ViewState::any(),
+                                    dds::sub::status::InstanceState::any())),
+                    handle);
+        }
+
+        dds::sub::LoanedSamples<T> await_resume()
+        {
+            if (_max_samples > 0) {
+                return _reader.select()
+                        .max_samples(static_cast<int32_t>(_max_samples))
+                        .take();
+            }
+            return _reader.take();
+        }
+
+    private:
+        dds::sub::DataReader<T> _reader;
+        DDSCoroutineExecutor &_executor;
+        size_t _max_samples;
+    };
+
+    // Await the next sample on this reader (batch of at most one). The
+    // coroutine must be driven by executor.run(); see
+    // DDSCoroutineExecutor.hpp for the threading contract.
+    ReadAwaitable next_sample(DDSCoroutineExecutor &executor)
+    {
+        return ReadAwaitable(_reader, executor, 1);
+    }
+
+    // Await whatever has accumulated on this reader (everything, or at
+    // most max_batch samples when non-zero), returned as a loaned batch
+    // like the loaned_batch callback path
+    ReadAwaitable next_batch(DDSCoroutineExecutor &executor, size_t max_batch = 0)
+    {
+        return ReadAwaitable(_reader, executor, max_batch);
+    }
+#endif  // defined(DDS_UTILS_HAS_COROUTINES)
+
     // Getter for DataReader
     dds::sub::DataReader<T> reader() const
     {
@@ -323,78 +881,144 @@ public:
     }
 
 private:
+    // Find the plain topic if another entity already created it, otherwise
+    // create it
+    void init_topic()
+    {
+        _topic = dds::topic::find<dds::topic::Topic<T>>(
+                _participant,
+                _topic_name);
+        if (_topic == dds::core::null) {
+            _topic = dds::topic::Topic<T>(_participant, _topic_name);
+        } else {
+            std::cout << "Topic " << _topic_name << " already created"
+                      << std::endl;
+        }
+    }
+
+    // Enable the reader status events, hook the dispatching handler and
+    // attach the condition to the AsyncWaitSet
+    void init_status_condition()
+    {
+        if (_reader == dds::core::null) {
+            return;
+        }
+
+        // Register this reader's performance counter block
+        _perf_counters = DDSPerfTelemetry::instance().register_entity(
+                _topic_name + ".reader");
+
+        std::cout << "Setting up status condition for " << _topic_name << std::endl;
+        _status_condition = dds::core::cond::StatusCondition(_reader);
+
+        // Enable subscription matched status
+        _status_condition.enabled_statuses(
+            dds::core::status::StatusMask::subscription_matched()
+            | dds::core::status::StatusMask::liveliness_changed()
+            | dds::core::status::StatusMask::requested_deadline_missed()
+            | dds::core::status::StatusMask::requested_incompatible_qos()
+            | dds::core::status::StatusMask::sample_lost()
+            | dds::core::status::StatusMask::sample_rejected());
+
+        // Attach handler directly - on_status_triggered will dispatch
+        _status_condition->handler([this](dds::core::cond::Condition) {
+            on_status_triggered();
+        });
+
+        // Attach to AsyncWaitSet
+        try {
+            _async_waitset.attach_condition(_status_condition);
+            std::cout << "Attached status condition to AsyncWaitset for " << _topic_name << std::endl;
+        } catch (const std::exception &e) {
+            std::cerr << "Error attaching status condition: " << e.what() << std::endl;
+        }
+
+        // Start the AsyncWaitSet
+        _async_waitset.start();
+    }
+
     // Default callback for subscription matched events
     void default_on_subscription_matched()
     {
         auto status = _reader.subscription_matched_status();
-        
-        std::cout << "[Reader] Subscription matched event for topic: " 
-                  << _reader.topic_description().name() << std::endl;
-        std::cout << "  Current count: " << status.current_count() << std::endl;
-        std::cout << "  Current count change: " << status.current_count_change() 
-                  << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() 
-                  << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Reader] Subscription matched event for topic: "
+            << _reader.topic_description().name()
+            << " | current: " << status.current_count()
+            << " (change " << status.current_count_change() << ")"
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")";
+        DDS_LOG_INFO(msg.str());
     }
 
     // Default callback for liveliness changed events
     void default_on_liveliness_changed()
     {
         auto status = _reader.liveliness_changed_status();
-        
-        std::cout << "[Reader] Liveliness changed event for topic: " 
-                  << _reader.topic_description().name() << std::endl;
-        std::cout << "  Alive count: " << status.alive_count() << std::endl;
-        std::cout << "  Alive count change: " << status.alive_count_change() << std::endl;
-        std::cout << "  Not alive count: " << status.not_alive_count() << std::endl;
-        std::cout << "  Not alive count change: " << status.not_alive_count_change() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Reader] Liveliness changed event for topic: "
+            << _reader.topic_description().name()
+            << " | alive: " << status.alive_count()
+            << " (change " << status.alive_count_change() << ")"
+            << " | not alive: " << status.not_alive_count()
+            << " (change " << status.not_alive_count_change() << ")";
+        DDS_LOG_INFO(msg.str());
     }
 
     // Default callback for requested deadline missed events
     void default_on_requested_deadline_missed()
     {
         auto status = _reader.requested_deadline_missed_status();
-        
-        std::cout << "[Reader] Requested deadline missed event for topic: " 
-                  << _reader.topic_description().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Reader] Requested deadline missed event for topic: "
+            << _reader.topic_description().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")";
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Default callback for requested incompatible QoS events
     void default_on_requested_incompatible_qos()
     {
         auto status = _reader.requested_incompatible_qos_status();
-        
-        std::cout << "[Reader] Requested incompatible QoS event for topic: " 
-                  << _reader.topic_description().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
-        std::cout << "  Last policy: " << status.last_policy_id() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Reader] Requested incompatible QoS event for topic: "
+            << _reader.topic_description().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")"
+            << " | last policy: " << status.last_policy_id();
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Default callback for sample lost events
     void default_on_sample_lost()
     {
         auto status = _reader.sample_lost_status();
-        
-        std::cout << "[Reader] Sample lost event for topic: " 
-                  << _reader.topic_description().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Reader] Sample lost event for topic: "
+            << _reader.topic_description().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")";
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Default callback for sample rejected events
     void default_on_sample_rejected()
     {
         auto status = _reader.sample_rejected_status();
-        
-        std::cout << "[Reader] Sample rejected event for topic: " 
-                  << _reader.topic_description().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
-        std::cout << "  Last reason: " << status.last_reason().to_string() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Reader] Sample rejected event for topic: "
+            << _reader.topic_description().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")"
+            << " | last reason: " << status.last_reason().to_string();
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Handler that checks which status triggered and dispatches accordingly
@@ -410,6 +1034,7 @@ private:
             } else {
                 default_on_subscription_matched();
             }
+            notify_match_waiters();
         }
         
         // Check if liveliness changed status triggered
@@ -458,6 +1083,167 @@ private:
         }
     }
 
+    // Microseconds elapsed since `start`, for the perf counter records
+    static uint64_t elapsed_usec(
+            const std::chrono::steady_clock::time_point &start)
+    {
+        return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+    }
+
+    // Hash for the instance-handle index: FNV-1a over the handle's key
+    // hash bytes - no formatting or allocation on the dispatch path
+    struct InstanceHandleHash {
+        size_t operator()(const dds::core::InstanceHandle &handle) const
+        {
+            const DDS_InstanceHandle_t &native = handle->native();
+            size_t hash = 14695981039346656037ull;
+            for (DDS_UnsignedLong i = 0; i < native.keyHash.length; i++) {
+                hash ^= native.keyHash.value[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+    };
+
+    // Route every NOT_READ sample to its instance's handler. Probes one
+    // sample with read() to learn which instance has data next, then takes
+    // that whole instance's batch with select().instance() and dispatches
+    // it - handler lookup is a single hash probe, not a key comparison per
+    // sample in application code.
+    void dispatch_by_instance()
+    {
+        const dds::sub::status::DataState not_read(
+                dds::sub::status::SampleState::not_read(),
+                dds::sub::status::ViewState::any(),
+                dds::sub::status::InstanceState::any());
+
+        // The per-instance take must accept READ samples too: the probe
+        // just marked one sample READ, and taking with not_read would
+        // strand it in the reader cache undelivered
+        const dds::sub::status::DataState any_sample_state(
+                dds::sub::status::SampleState::any(),
+                dds::sub::status::ViewState::any(),
+                dds::sub::status::InstanceState::any());
+
+        for (;;) {
+            dds::core::InstanceHandle handle = dds::core::InstanceHandle::nil();
+            bool is_new_instance = false;
+            {
+                // Probe with read (not take) so the sample stays available
+                // for the per-instance take; the probe loan is returned
+                // when this scope ends
+                auto probe = _reader.select()
+                                     .state(not_read)
+                                     .max_samples(1)
+                                     .read();
+                if (probe.length() == 0) {
+                    return;  // nothing left to dispatch
+                }
+                handle = probe.begin()->info().instance_handle();
+                is_new_instance =
+                        (probe.begin()->info().state().view_state()
+                         == dds::sub::status::ViewState::new_view());
+            }
+
+            if (is_new_instance) {
+                on_instance_appeared(handle);
+            }
+
+            // Drain exactly this instance
+            const auto take_start = std::chrono::steady_clock::now();
+            auto batch = _reader.select()
+                                 .instance(handle)
+                                 .state(any_sample_state)
+                                 .take();
+            _perf_counters->record_take(
+                    batch.length(),
+                    elapsed_usec(take_start));
+            if (batch.length() == 0) {
+                continue;
+            }
+
+            // Disposal/unregistration shows up as a not-alive instance state
+            // within the batch
+            bool instance_gone = false;
+            for (const auto &sample : batch) {
+                if (sample.info().state().instance_state()
+                        != dds::sub::status::InstanceState::alive()) {
+                    instance_gone = true;
+                }
+            }
+
+            InstanceBatchFunction handler;
+            {
+                std::lock_guard<std::mutex> lock(_instance_mutex);
+                auto it = _instance_handlers.find(handle);
+                if (it != _instance_handlers.end()) {
+                    handler = it->second;
+                }
+            }
+            const auto callback_start = std::chrono::steady_clock::now();
+            if (handler) {
+                handler(batch);
+            } else if (_instance_default_handler) {
+                _instance_default_handler(batch);
+            }
+            _perf_counters->record_callback(elapsed_usec(callback_start));
+
+            if (instance_gone) {
+                {
+                    std::lock_guard<std::mutex> lock(_instance_mutex);
+                    _instance_handlers.erase(handle);
+                }
+                if (_instance_unregistered_callback) {
+                    _instance_unregistered_callback(handle);
+                }
+            }
+        }
+    }
+
+    // Resolve pending key-based registrations against a newly appeared
+    // instance, then fire the lifecycle callback
+    void on_instance_appeared(const dds::core::InstanceHandle &handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_instance_mutex);
+            for (auto it = _pending_instance_handlers.begin();
+                 it != _pending_instance_handlers.end();) {
+                if (_reader.lookup_instance(it->first) == handle) {
+                    _instance_handlers[handle] = it->second;
+                    it = _pending_instance_handlers.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        if (_instance_registered_callback) {
+            _instance_registered_callback(handle);
+        }
+    }
+
+    // Complete every pending match future whose threshold is reached
+    void notify_match_waiters()
+    {
+        const int current =
+                _reader.subscription_matched_status().current_count();
+        std::lock_guard<std::mutex> lock(_match_mutex);
+        for (auto it = _match_promises.begin(); it != _match_promises.end();) {
+            if (current >= it->first) {
+                it->second.set_value();
+                it = _match_promises.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Keep the participant setup alive - owns the shared QosProvider and
+    // the memoized QoS caches used at construction time
+    std::shared_ptr<DDSParticipantSetup> _participant_setup;
+
     dds::domain::DomainParticipant _participant = dds::core::null;
 
     // Async Waitset - reference to the one owned by DDSParticipantSetup
@@ -465,16 +1251,47 @@ private:
 
     dds::sub::DataReader<T> _reader = dds::core::null;
     dds::topic::Topic<T> _topic = dds::core::null;
+    dds::topic::ContentFilteredTopic<T> _content_filtered_topic = dds::core::null;
     dds::sub::cond::ReadCondition _read_condition = dds::core::null;
     dds::core::cond::StatusCondition _status_condition = dds::core::null;
-    dds::core::QosProvider _qos_provider = dds::core::null;
     const std::string _topic_name;
     const std::string _qos_file;
     const std::string _qos_profile;
 
+    // Per-reader performance counter block (registered with DDSPerfTelemetry)
+    std::shared_ptr<DDSEntityCounters> _perf_counters;
+
     // Custom data processing function
     DataProcessingFunction _custom_data_handler;
-    
+
+    // Loaned batch processing function and batch bound (0 = unbounded)
+    LoanedBatchFunction _loaned_batch_handler;
+    size_t _max_batch_size = 0;
+
+    // Decimation state: keep-1-in-N fallback factor (0/1 = off) and the
+    // running sample count it indexes into
+    DecimatedSampleFunction _decimated_sample_handler;
+    size_t _decimation_keep_one_in_n = 0;
+    size_t _decimation_counter = 0;
+
+    // Pending match futures: (match threshold, promise)
+    std::mutex _match_mutex;
+    std::vector<std::pair<int, std::promise<void>>> _match_promises;
+
+    // Instance dispatch state: handle-to-handler hash index, key-based
+    // registrations waiting for their instance to appear, and lifecycle
+    // callbacks
+    std::mutex _instance_mutex;
+    std::unordered_map<
+            dds::core::InstanceHandle,
+            InstanceBatchFunction,
+            InstanceHandleHash>
+            _instance_handlers;
+    std::vector<std::pair<T, InstanceBatchFunction>> _pending_instance_handlers;
+    InstanceBatchFunction _instance_default_handler;
+    InstanceLifecycleFunction _instance_registered_callback;
+    InstanceLifecycleFunction _instance_unregistered_callback;
+
     // Registered status callbacks
     SubscriptionMatchedFunction _subscription_matched_callback;
     LivelinessChangedFunction _liveliness_changed_callback;
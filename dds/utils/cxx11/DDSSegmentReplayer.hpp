@@ -0,0 +1,291 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_SEGMENT_REPLAYER_HPP
+#define DDS_SEGMENT_REPLAYER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DDSSegmentRecorder.hpp"  // on-disk format: SegmentHeader, IndexEntry
+
+/*
+ * DDSSegmentReplayer Class
+ *
+ * Read side of the DDSSegmentRecorder on-disk format, built for
+ * faster-than-realtime regression replay. The Replay Service caps at
+ * roughly realtime and takes seconds to start; this class memory-maps
+ * the recorded segment ring and exposes the samples in capture order so
+ * an app can push them through DDSWriterSetup at any time scale:
+ *
+ *   - Capture-order Merge: every segment's sidecar index is loaded and
+ *                          the entries of all segments are merged by
+ *                          capture timestamp, so replay order is correct
+ *                          even after ring wraps reordered the files
+ *   - Zero-copy Records: record(i) returns the index entry plus a
+ *                        pointer straight into the read-only data
+ *                        mapping - no payload is copied until the
+ *                        publishing side deserializes it
+ *   - Pipelined Readahead: a background thread walks a configurable
+ *                          byte window ahead of the publish cursor
+ *                          (advance_cursor()) issuing
+ *                          madvise(MADV_WILLNEED), so page faults are
+ *                          paid by the readahead thread, not in the
+ *                          publish loop's timing path
+ *
+ * Scheduling (time-scale factor, ack pacing) is the caller's job; see
+ * apps/cxx11/dds_replayer.
+ */
+class DDSSegmentReplayer {
+public:
+    struct Record {
+        const DDSSegmentRecorder::IndexEntry *entry;
+        const uint8_t *payload;
+    };
+
+    explicit DDSSegmentReplayer(const std::string &directory)
+            : _directory(directory)
+    {
+    }
+
+    ~DDSSegmentReplayer()
+    {
+        close();
+    }
+
+    DDSSegmentReplayer(const DDSSegmentReplayer &) = delete;
+    DDSSegmentReplayer &operator=(const DDSSegmentReplayer &) = delete;
+
+    // Map every segment pair in the recording directory and build the
+    // merged capture-order record list. Returns false if no valid
+    // segment is found or the recording holds no samples.
+    bool open()
+    {
+        for (size_t slot = 0;; slot++) {
+            Segment segment;
+            if (!map_segment(segment, slot)) {
+                break;  // first missing slot ends the ring
+            }
+            if (segment.header.magic != DDSSegmentRecorder::SEGMENT_MAGIC) {
+                std::cerr << "DDSSegmentReplayer: bad magic in slot " << slot
+                          << ", skipping" << std::endl;
+                unmap_segment(segment);
+                continue;
+            }
+            _segments.push_back(segment);
+        }
+
+        if (_segments.empty()) {
+            std::cerr << "DDSSegmentReplayer: no segments found in "
+                      << _directory << std::endl;
+            return false;
+        }
+
+        // Merge all segments' entries into capture order; the ring may
+        // have wrapped, so file order is not time order
+        for (size_t s = 0; s < _segments.size(); s++) {
+            const Segment &segment = _segments[s];
+            for (uint64_t i = 0; i < segment.header.record_count; i++) {
+                _records.push_back(
+                        { &segment.index[i],
+                          segment.data + segment.index[i].offset });
+            }
+        }
+        std::sort(
+                _records.begin(),
+                _records.end(),
+                [](const Record &a, const Record &b) {
+                    return a.entry->timestamp_ns < b.entry->timestamp_ns;
+                });
+
+        // A capture session that saw no samples still leaves valid
+        // segment headers (dds_recorder stamps them at start); that is
+        // not replayable
+        if (_records.empty()) {
+            std::cerr << "DDSSegmentReplayer: recording in " << _directory
+                      << " contains no samples" << std::endl;
+            close();
+            return false;
+        }
+
+        std::cout << "DDSSegmentReplayer: " << _records.size()
+                  << " records across " << _segments.size() << " segments"
+                  << std::endl;
+        return true;
+    }
+
+    size_t record_count() const
+    {
+        return _records.size();
+    }
+
+    const Record &record(size_t i) const
+    {
+        return _records[i];
+    }
+
+    // Start the readahead thread: keeps window_bytes of payload ahead of
+    // the cursor advised into the page cache
+    void start_readahead(size_t window_bytes = 64 * 1024 * 1024)
+    {
+        _readahead_running = true;
+        _readahead_thread = std::thread([this, window_bytes]() {
+            size_t advised = 0;
+            while (_readahead_running) {
+                const size_t cursor = _cursor.load(std::memory_order_relaxed);
+                advised = std::max(advised, cursor);
+
+                size_t window_used = 0;
+                while (advised < _records.size()
+                        && window_used < window_bytes) {
+                    advise_record(_records[advised]);
+                    window_used += _records[advised].entry->length;
+                    advised++;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        });
+    }
+
+    // Publish-side cursor: records before this index are done and may be
+    // dropped from the page cache behind the readahead window
+    void advance_cursor(size_t next_record)
+    {
+        _cursor.store(next_record, std::memory_order_relaxed);
+    }
+
+    void close()
+    {
+        if (_readahead_running) {
+            _readahead_running = false;
+            _readahead_thread.join();
+        }
+        for (auto &segment : _segments) {
+            unmap_segment(segment);
+        }
+        _segments.clear();
+        _records.clear();
+    }
+
+private:
+    struct Segment {
+        int data_fd = -1;
+        int index_fd = -1;
+        uint8_t *data = nullptr;
+        size_t data_bytes = 0;
+        DDSSegmentRecorder::IndexEntry *index = nullptr;
+        size_t index_bytes = 0;
+        DDSSegmentRecorder::SegmentHeader header = {};
+    };
+
+    std::string segment_path(size_t slot, const char *suffix) const
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "/segment_%03zu.%s", slot, suffix);
+        return _directory + name;
+    }
+
+    bool map_segment(Segment &segment, size_t slot)
+    {
+        segment.data_fd =
+                ::open(segment_path(slot, "dat").c_str(), O_RDONLY);
+        segment.index_fd =
+                ::open(segment_path(slot, "idx").c_str(), O_RDONLY);
+        if (segment.data_fd < 0 || segment.index_fd < 0) {
+            unmap_segment(segment);
+            return false;
+        }
+
+        struct stat data_stat, index_stat;
+        if (fstat(segment.data_fd, &data_stat) != 0
+                || fstat(segment.index_fd, &index_stat) != 0) {
+            unmap_segment(segment);
+            return false;
+        }
+        segment.data_bytes = data_stat.st_size;
+        segment.index_bytes = index_stat.st_size;
+
+        segment.data = static_cast<uint8_t *>(mmap(
+                nullptr,
+                segment.data_bytes,
+                PROT_READ,
+                MAP_SHARED,
+                segment.data_fd,
+                0));
+        segment.index = static_cast<DDSSegmentRecorder::IndexEntry *>(mmap(
+                nullptr,
+                segment.index_bytes,
+                PROT_READ,
+                MAP_SHARED,
+                segment.index_fd,
+                0));
+        if (segment.data == MAP_FAILED || segment.index == MAP_FAILED) {
+            std::cerr << "DDSSegmentReplayer: mmap failed: "
+                      << strerror(errno) << std::endl;
+            unmap_segment(segment);
+            return false;
+        }
+
+        std::memcpy(&segment.header, segment.data, sizeof(segment.header));
+        return true;
+    }
+
+    void unmap_segment(Segment &segment)
+    {
+        if (segment.data != nullptr && segment.data != MAP_FAILED) {
+            munmap(segment.data, segment.data_bytes);
+        }
+        if (segment.index != nullptr && segment.index != MAP_FAILED) {
+            munmap(segment.index, segment.index_bytes);
+        }
+        if (segment.data_fd >= 0) {
+            ::close(segment.data_fd);
+        }
+        if (segment.index_fd >= 0) {
+            ::close(segment.index_fd);
+        }
+        segment = Segment();
+    }
+
+    // Page-align the payload span and ask the kernel to fault it in
+    void advise_record(const Record &record)
+    {
+        const long page = sysconf(_SC_PAGESIZE);
+        auto address = reinterpret_cast<uintptr_t>(record.payload);
+        const uintptr_t aligned = address & ~(static_cast<uintptr_t>(page) - 1);
+        madvise(reinterpret_cast<void *>(aligned),
+                (address - aligned) + record.entry->length,
+                MADV_WILLNEED);
+    }
+
+    std::string _directory;
+    std::vector<Segment> _segments;
+    std::vector<Record> _records;
+    std::atomic<size_t> _cursor { 0 };
+    std::atomic<bool> _readahead_running { false };
+    std::thread _readahead_thread;
+};
+
+#endif  // DDS_SEGMENT_REPLAYER_HPP
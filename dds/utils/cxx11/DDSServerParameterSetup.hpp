@@ -16,8 +16,9 @@
 #include <rti/rti.hpp>
 
 #include <string>
-#include <map>
+#include <unordered_map>
 #include <vector>
+#include <memory>
 #include <functional>
 #include <iostream>
 #include <algorithm>
@@ -36,7 +37,12 @@ using namespace rti::all;
  *   - CFT filters requests by node_id at the middleware level
  *   - Uses AsyncWaitSet with ReadConditions for async processing
  *   - Pure DDS DataReader/DataWriter entities
- * 
+ *   - Indexed store: parameters live in an insertion-ordered vector with a
+ *     hash index by name, so lookups are O(1) probes and iteration order is
+ *     stable; a lazily rebuilt copy-on-write snapshot backs bulk reads
+ *   - Batched events: begin_batch()/end_batch() coalesce any number of
+ *     set/delete calls into a single ParameterEvent sample
+ *
  * Usage:
  *   DDSServerParameterSetup server(participant, "my_node");
  *   server.set_parameters(params);  // Auto-publishes event
@@ -95,14 +101,16 @@ public:
     void set_parameter(const example_types::Parameter& param)
     {
         std::string name(param.name());
-        bool is_new = (_parameters.find(name) == _parameters.end());
-        _parameters[name] = param;
-        
-        if (is_new) {
+        auto it = _parameter_index.find(name);
+        if (it == _parameter_index.end()) {
+            _parameter_index.emplace(name, _parameter_list.size());
+            _parameter_list.push_back(param);
             _pending_new.push_back(param);
         } else {
+            _parameter_list[it->second] = param;
             _pending_changed.push_back(param);
         }
+        _snapshot.reset();  // snapshot is stale, rebuilt on next bulk read
     }
 
     void set_parameters(const std::vector<example_types::Parameter>& params)
@@ -115,58 +123,99 @@ public:
 
     bool has_parameter(const std::string& name) const
     {
-        return _parameters.find(name) != _parameters.end();
+        return _parameter_index.find(name) != _parameter_index.end();
     }
 
     const example_types::Parameter& get_parameter(const std::string& name) const
     {
-        return _parameters.at(name);
+        return _parameter_list[_parameter_index.at(name)];
     }
 
-    std::vector<example_types::Parameter> get_all_parameters() const
+    // Copy-on-write bulk snapshot of the whole store in stable insertion
+    // order. The shared vector is rebuilt at most once per mutation, so
+    // steady-state polls of an unchanged store cost one shared_ptr copy.
+    std::shared_ptr<const std::vector<example_types::Parameter>> snapshot()
     {
-        std::vector<example_types::Parameter> result;
-        for (const auto& kv : _parameters) {
-            result.push_back(kv.second);
+        if (!_snapshot) {
+            _snapshot = std::make_shared<const std::vector<example_types::Parameter>>(
+                _parameter_list);
         }
-        return result;
+        return _snapshot;
+    }
+
+    std::vector<example_types::Parameter> get_all_parameters() const
+    {
+        return _parameter_list;
     }
 
     void delete_parameter(const std::string& name)
     {
-        auto it = _parameters.find(name);
-        if (it != _parameters.end()) {
-            _pending_deleted.push_back(it->second);
-            _parameters.erase(it);
+        auto it = _parameter_index.find(name);
+        if (it != _parameter_index.end()) {
+            const size_t slot = it->second;
+            _pending_deleted.push_back(_parameter_list[slot]);
+            _parameter_list.erase(_parameter_list.begin() + slot);
+            _parameter_index.erase(it);
+            // Deletion shifts everything behind the slot - reindex those
+            // entries (deletes are rare; lookups and gets stay O(1))
+            for (auto& entry : _parameter_index) {
+                if (entry.second > slot) {
+                    entry.second--;
+                }
+            }
+            _snapshot.reset();
         }
         publish_event();
     }
 
-    size_t parameter_count() const { return _parameters.size(); }
+    size_t parameter_count() const { return _parameter_list.size(); }
 
     const std::string& node_name() const { return _node_name; }
 
+    // Names in stable insertion order (the order parameters were declared)
     std::vector<std::string> list_parameter_names(const std::string& prefix = "", uint32_t depth = 0) const
     {
         std::vector<std::string> names;
-        for (const auto& kv : _parameters) {
-            if (prefix.empty() || kv.first.find(prefix) == 0) {
+        for (const auto& param : _parameter_list) {
+            std::string name(param.name());
+            if (prefix.empty() || name.find(prefix) == 0) {
                 if (depth > 0) {
-                    size_t dots = std::count(kv.first.begin(), kv.first.end(), '.');
+                    size_t dots = std::count(name.begin(), name.end(), '.');
                     if (dots >= depth) continue;
                 }
-                names.push_back(kv.first);
+                names.push_back(name);
             }
         }
         return names;
     }
 
+    //--------------------------------------------------------------------------
+    // Event Batching
+    //--------------------------------------------------------------------------
+
+    // Suspend event publication until end_batch() - every set/delete in
+    // between lands in one coalesced ParameterEvent sample instead of one
+    // sample per mutating call
+    void begin_batch()
+    {
+        _batching = true;
+    }
+
+    void end_batch()
+    {
+        _batching = false;
+        publish_event();
+    }
+
     //--------------------------------------------------------------------------
     // Event Publishing
     //--------------------------------------------------------------------------
 
     void publish_event()
     {
+        if (_batching) {
+            return;  // end_batch() publishes the coalesced event
+        }
         if (_pending_new.empty() && _pending_changed.empty() && _pending_deleted.empty()) {
             return;
         }
@@ -197,12 +246,7 @@ private:
     {
         auto& participant = _participant_setup->participant();
         auto& aws = _participant_setup->async_waitset();
-        
-        // Get QoS provider
-        dds::core::QosProvider qos_provider(
-            _participant_setup->qos_file_path(), 
-            _qos_profile);
-        
+
         //----------------------------------------------------------------------
         // Create Topics
         //----------------------------------------------------------------------
@@ -255,19 +299,19 @@ private:
         
         _event_writer = dds::pub::DataWriter<example_types::ParameterEvent>(
             publisher, _event_topic, 
-            qos_provider.extensions().datawriter_qos_w_topic_name(topics::PARAMETER_EVENTS_TOPIC));
+            _participant_setup->datawriter_qos(_qos_profile, topics::PARAMETER_EVENTS_TOPIC));
         
         _set_response_writer = dds::pub::DataWriter<example_types::SetParametersResponse>(
             publisher, _set_response_topic, 
-            qos_provider.extensions().datawriter_qos_w_topic_name(topics::SET_PARAMETERS_RESPONSE_TOPIC));
+            _participant_setup->datawriter_qos(_qos_profile, topics::SET_PARAMETERS_RESPONSE_TOPIC));
         
         _get_response_writer = dds::pub::DataWriter<example_types::GetParametersResponse>(
             publisher, _get_response_topic, 
-            qos_provider.extensions().datawriter_qos_w_topic_name(topics::GET_PARAMETERS_RESPONSE_TOPIC));
+            _participant_setup->datawriter_qos(_qos_profile, topics::GET_PARAMETERS_RESPONSE_TOPIC));
         
         _list_response_writer = dds::pub::DataWriter<example_types::ListParametersResponse>(
             publisher, _list_response_topic, 
-            qos_provider.extensions().datawriter_qos_w_topic_name(topics::LIST_PARAMETERS_RESPONSE_TOPIC));
+            _participant_setup->datawriter_qos(_qos_profile, topics::LIST_PARAMETERS_RESPONSE_TOPIC));
 
         //----------------------------------------------------------------------
         // Create Readers on CFTs with topic-aware QoS (only receive requests for this node)
@@ -276,15 +320,15 @@ private:
         
         _set_request_reader = dds::sub::DataReader<example_types::SetParametersRequest>(
             subscriber, _set_request_cft, 
-            qos_provider.extensions().datareader_qos_w_topic_name(topics::SET_PARAMETERS_REQUEST_TOPIC));
+            _participant_setup->datareader_qos(_qos_profile, topics::SET_PARAMETERS_REQUEST_TOPIC));
         
         _get_request_reader = dds::sub::DataReader<example_types::GetParametersRequest>(
             subscriber, _get_request_cft, 
-            qos_provider.extensions().datareader_qos_w_topic_name(topics::GET_PARAMETERS_REQUEST_TOPIC));
+            _participant_setup->datareader_qos(_qos_profile, topics::GET_PARAMETERS_REQUEST_TOPIC));
         
         _list_request_reader = dds::sub::DataReader<example_types::ListParametersRequest>(
             subscriber, _list_request_cft, 
-            qos_provider.extensions().datareader_qos_w_topic_name(topics::LIST_PARAMETERS_REQUEST_TOPIC));
+            _participant_setup->datareader_qos(_qos_profile, topics::LIST_PARAMETERS_REQUEST_TOPIC));
 
         //----------------------------------------------------------------------
         // Create ReadConditions and attach to AsyncWaitSet
@@ -349,18 +393,23 @@ private:
             // CFT already filtered by node_id
             const auto& request = sample.data();
             
-            example_types::GetParametersResponse response;
-            response.node_id(_node_name);
-            response.request_id(request.request_id());
-            
+            // The response sample is reused across requests so its
+            // parameters sequence keeps its capacity - a get of N names is
+            // N hash probes with no steady-state allocation
+            _get_response.node_id(_node_name);
+            _get_response.request_id(request.request_id());
+            _get_response.parameters().clear();
+
             for (const auto& name : request.names()) {
                 std::string param_name(name);
-                if (has_parameter(param_name)) {
-                    response.parameters().push_back(get_parameter(param_name));
+                auto it = _parameter_index.find(param_name);
+                if (it != _parameter_index.end()) {
+                    _get_response.parameters().push_back(
+                        _parameter_list[it->second]);
                 }
             }
-            
-            _get_response_writer.write(response);
+
+            _get_response_writer.write(_get_response);
         }
     }
 
@@ -421,8 +470,12 @@ private:
     std::string _qos_profile;
     SetParametersCallback _server_callback;
 
-    // Parameter storage
-    std::map<std::string, example_types::Parameter> _parameters;
+    // Parameter storage: insertion-ordered vector + hash index by name.
+    // _snapshot caches the copy-on-write bulk view and is reset on mutation.
+    std::vector<example_types::Parameter> _parameter_list;
+    std::unordered_map<std::string, size_t> _parameter_index;
+    std::shared_ptr<const std::vector<example_types::Parameter>> _snapshot;
+    bool _batching = false;
     std::vector<example_types::Parameter> _pending_new;
     std::vector<example_types::Parameter> _pending_changed;
     std::vector<example_types::Parameter> _pending_deleted;
@@ -452,6 +505,9 @@ private:
     dds::sub::DataReader<example_types::GetParametersRequest> _get_request_reader = dds::core::null;
     dds::sub::DataReader<example_types::ListParametersRequest> _list_request_reader = dds::core::null;
 
+    // Reused GetParameters response - keeps sequence capacity across requests
+    example_types::GetParametersResponse _get_response;
+
     // Read conditions for async handling
     dds::sub::cond::ReadCondition _set_read_condition = dds::core::null;
     dds::sub::cond::ReadCondition _get_read_condition = dds::core::null;
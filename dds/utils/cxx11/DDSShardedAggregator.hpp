@@ -0,0 +1,293 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_SHARDED_AGGREGATOR_HPP
+#define DDS_SHARDED_AGGREGATOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * DDSShardedAggregator Class
+ *
+ * Parallel fan-in engine for multi-reader aggregation nodes. The
+ * example_io_app pattern - several DDSReaderSetup handlers funneling
+ * into shared state behind one mutex, on whichever AsyncWaitSet pool
+ * thread fires - flatlines above ~10k aggregate samples/sec because
+ * every handler serializes on the same lock. This engine shards the
+ * state by key instead:
+ *
+ *   - Key-hash Routing: submit(key_hash, work) routes each sample to one
+ *                       of N shards (hash modulo), so all updates for a
+ *                       key land on the same shard's state and per-key
+ *                       ordering is preserved. hash_key() covers the
+ *                       common string-key case (e.g. Config's
+ *                       destination_id)
+ *   - Owned Shards: each shard pairs a work queue with its own StateT
+ *                   and one worker thread; in the steady state a worker
+ *                   only takes its own uncontended locks, so throughput
+ *                   scales with shards instead of serializing
+ *   - Work Stealing: an idle worker steals the oldest entries of the
+ *                    busiest other queue, so a skewed key distribution
+ *                    (a few hot destination_ids backing up one shard)
+ *                    drains its backlog with idle cores instead of
+ *                    waiting on one worker. Stolen work runs against the
+ *                    owning shard's state under that shard's state
+ *                    mutex, and tasks are popped while holding it, so
+ *                    per-key update order is preserved even when owner
+ *                    and thief drain the same backlog (updates to one
+ *                    shard's state remain serialized by design)
+ *   - Merge Phase: merge() visits every shard's state under its state
+ *                  mutex for cross-shard queries (totals, top-k) without
+ *                  stopping ingest
+ *
+ * Reader handlers copy what they need out of the loaned sample into the
+ * submitted closure - loans must not escape the dispatch:
+ *
+ *   reader->set_loaned_batch_handler([&](auto &samples) {
+ *       for (const auto &sample : samples) {
+ *           if (!sample.info().valid()) continue;
+ *           auto data = sample.data();  // copy, loan stays in the batch
+ *           aggregator.submit(
+ *                   DDSShardedAggregator<NodeState>::hash_key(
+ *                           data.destination_id()),
+ *                   [data](NodeState &state) { state.apply(data); });
+ *       }
+ *   });
+ */
+template <typename StateT>
+class DDSShardedAggregator {
+public:
+    using WorkFunction = std::function<void(StateT &)>;
+    using MergeFunction = std::function<void(const StateT &, size_t)>;
+
+    explicit DDSShardedAggregator(size_t shard_count = 0)
+    {
+        if (shard_count == 0) {
+            shard_count = std::thread::hardware_concurrency();
+            if (shard_count == 0) {
+                shard_count = 4;
+            }
+        }
+
+        _shards.reserve(shard_count);
+        for (size_t i = 0; i < shard_count; i++) {
+            _shards.emplace_back(new Shard());
+        }
+        for (size_t i = 0; i < shard_count; i++) {
+            _shards[i]->worker =
+                    std::thread([this, i]() { worker_loop(i); });
+        }
+
+        std::cout << "DDSShardedAggregator running with " << shard_count
+                  << " shards" << std::endl;
+    }
+
+    ~DDSShardedAggregator()
+    {
+        shutdown();
+    }
+
+    DDSShardedAggregator(const DDSShardedAggregator &) = delete;
+    DDSShardedAggregator &operator=(const DDSShardedAggregator &) = delete;
+
+    // Stable hash for string keys (topic key fields like destination_id)
+    static uint64_t hash_key(const std::string &key)
+    {
+        return std::hash<std::string>()(key);
+    }
+
+    // Route work to the shard owning key_hash. Called from reader
+    // handlers on AsyncWaitSet pool threads; only the target shard's
+    // queue lock is taken, never a global one.
+    void submit(uint64_t key_hash, WorkFunction work)
+    {
+        Shard &shard = *_shards[key_hash % _shards.size()];
+        {
+            std::lock_guard<std::mutex> lock(shard.queue_mutex);
+            shard.queue.push_back(std::move(work));
+        }
+        shard.wakeup.notify_one();
+        _submitted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Cross-shard query: visits each shard's state under its state
+    // mutex. Ingest keeps running; the view is consistent per shard, not
+    // globally atomic.
+    void merge(const MergeFunction &visitor) const
+    {
+        for (size_t i = 0; i < _shards.size(); i++) {
+            std::lock_guard<std::mutex> lock(_shards[i]->state_mutex);
+            visitor(_shards[i]->state, i);
+        }
+    }
+
+    // Drain every queue and stop the workers; safe to call repeatedly
+    void shutdown()
+    {
+        if (!_running.exchange(false)) {
+            return;
+        }
+        for (auto &shard : _shards) {
+            shard->wakeup.notify_all();
+        }
+        for (auto &shard : _shards) {
+            shard->worker.join();
+        }
+
+        std::cout << "DDSShardedAggregator stopped: " << processed_count()
+                  << " samples processed (" << stolen_count() << " stolen)"
+                  << std::endl;
+    }
+
+    size_t shard_count() const
+    {
+        return _shards.size();
+    }
+
+    uint64_t submitted_count() const
+    {
+        return _submitted.load(std::memory_order_relaxed);
+    }
+
+    uint64_t processed_count() const
+    {
+        uint64_t total = 0;
+        for (const auto &shard : _shards) {
+            total += shard->processed.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    uint64_t stolen_count() const
+    {
+        uint64_t total = 0;
+        for (const auto &shard : _shards) {
+            total += shard->stolen.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    struct Shard {
+        std::thread worker;
+
+        std::mutex queue_mutex;
+        std::condition_variable wakeup;
+        std::deque<WorkFunction> queue;
+
+        // Ordinarily only this shard's worker takes the state mutex, so
+        // it stays uncontended; a thief takes it while running stolen
+        // work for this shard
+        std::mutex state_mutex;
+        StateT state;
+
+        std::atomic<uint64_t> processed { 0 };
+        std::atomic<uint64_t> stolen { 0 };
+    };
+
+    // Pop and run the oldest task of `shard` against its state. The pop
+    // happens while holding the state mutex, so pop order is execution
+    // order - owner and thief cannot reorder one shard's updates.
+    // Lock order is always state_mutex then queue_mutex.
+    bool run_one(Shard &shard)
+    {
+        std::lock_guard<std::mutex> state_lock(shard.state_mutex);
+        WorkFunction work;
+        {
+            std::lock_guard<std::mutex> queue_lock(shard.queue_mutex);
+            if (shard.queue.empty()) {
+                return false;
+            }
+            work = std::move(shard.queue.front());
+            shard.queue.pop_front();
+        }
+        work(shard.state);
+        shard.processed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Drain our own queue; when empty, steal the oldest backlog entry
+    // from the longest other queue; otherwise sleep until submitted work
+    // wakes us
+    void worker_loop(size_t index)
+    {
+        Shard &own = *_shards[index];
+
+        while (true) {
+            if (run_one(own)) {
+                continue;
+            }
+
+            if (steal(index)) {
+                continue;
+            }
+
+            if (!_running.load(std::memory_order_relaxed)) {
+                // Queues are empty (ours and nothing to steal) - done
+                return;
+            }
+
+            std::unique_lock<std::mutex> lock(own.queue_mutex);
+            own.wakeup.wait_for(
+                    lock,
+                    std::chrono::milliseconds(2),
+                    [this, &own]() {
+                        return !own.queue.empty()
+                                || !_running.load(std::memory_order_relaxed);
+                    });
+        }
+    }
+
+    // Take the front (oldest) entry of the deepest other queue and run
+    // it against that shard's state
+    bool steal(size_t thief_index)
+    {
+        size_t victim_index = thief_index;
+        size_t victim_depth = 0;
+        for (size_t i = 0; i < _shards.size(); i++) {
+            if (i == thief_index) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(_shards[i]->queue_mutex);
+            if (_shards[i]->queue.size() > victim_depth) {
+                victim_depth = _shards[i]->queue.size();
+                victim_index = i;
+            }
+        }
+        if (victim_index == thief_index) {
+            return false;
+        }
+
+        if (!run_one(*_shards[victim_index])) {
+            return false;  // drained since we measured
+        }
+        _shards[thief_index]->stolen.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic<bool> _running { true };
+    std::atomic<uint64_t> _submitted { 0 };
+};
+
+#endif  // DDS_SHARDED_AGGREGATOR_HPP
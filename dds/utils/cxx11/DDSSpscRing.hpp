@@ -0,0 +1,142 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_SPSC_RING_HPP
+#define DDS_SPSC_RING_HPP
+
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <thread>
+#include <cstddef>
+
+/*
+ * DDSSpscRing Class
+ *
+ * Fixed-capacity lock-free single-producer/single-consumer ring buffer used
+ * as a handoff stage between DDS callbacks and application threads:
+ *   - Producer side: an AsyncWaitSet callback (e.g. the loaned batch handler
+ *     of DDSReaderSetup) pushes moved samples or whole LoanedSamples batches
+ *     without blocking the middleware dispatch thread
+ *   - Consumer side: an application thread pops and processes items at its
+ *     own pace, so a processing hiccup no longer backs up into the DDS
+ *     receive queue and triggers sample_rejected at high burst rates
+ *
+ * try_push never blocks; when the ring is full the item is rejected and the
+ * dropped counter is incremented so the application has visibility into
+ * back-pressure. Exactly one producer thread and one consumer thread are
+ * supported - that is what makes the ring lock-free with plain
+ * acquire/release atomics.
+ */
+template <typename T>
+class DDSSpscRing {
+public:
+    // Capacity is rounded up to the next power of two so the ring can mask
+    // instead of modulo on the hot path
+    explicit DDSSpscRing(size_t capacity)
+            : _capacity(round_up_pow2(capacity)),
+              _mask(_capacity - 1),
+              _slots(_capacity),
+              _head(0),
+              _tail(0),
+              _dropped(0)
+    {
+    }
+
+    DDSSpscRing(const DDSSpscRing &) = delete;
+    DDSSpscRing &operator=(const DDSSpscRing &) = delete;
+
+    // Producer side: move an item into the ring. Returns false (and counts
+    // the drop) when the ring is full. Never blocks.
+    bool try_push(T &&item)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail >= _capacity) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _slots[head & _mask] = std::move(item);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: move the oldest item out of the ring. Returns false
+    // when the ring is empty. Never blocks.
+    bool try_pop(T &item)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t head = _head.load(std::memory_order_acquire);
+        if (tail == head) {
+            return false;
+        }
+        item = std::move(_slots[tail & _mask]);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side convenience: wait for an item with a bounded sleep-based
+    // backoff. Returns false if the timeout expires with no item available.
+    bool pop_wait(T &item, const std::chrono::milliseconds &timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!try_pop(item)) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        return true;
+    }
+
+    // Approximate number of items currently queued
+    size_t size_approx() const
+    {
+        const size_t head = _head.load(std::memory_order_acquire);
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    // Number of items rejected because the ring was full
+    size_t dropped_count() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    size_t capacity() const
+    {
+        return _capacity;
+    }
+
+private:
+    static size_t round_up_pow2(size_t value)
+    {
+        size_t pow2 = 1;
+        while (pow2 < value) {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::vector<T> _slots;
+
+    // Head/tail indices grow monotonically; slot index is (value & mask).
+    // Each is written by exactly one thread and read by the other.
+    std::atomic<size_t> _head;
+    std::atomic<size_t> _tail;
+    std::atomic<size_t> _dropped;
+};
+
+#endif  // DDS_SPSC_RING_HPP
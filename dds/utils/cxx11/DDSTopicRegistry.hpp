@@ -0,0 +1,188 @@
+/*
+ * (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the software solely for use with RTI Connext DDS. Licensee may
+ * redistribute copies of the software provided that all such copies are subject
+ * to this license. The software is provided "as is", with no warranty of any
+ * type, including any warranty for fitness for any purpose. RTI is under no
+ * obligation to maintain or support the software. RTI shall not be liable for
+ * any incidental or consequential damages arising out of the use or inability
+ * to use the software.
+ */
+
+#ifndef DDS_TOPIC_REGISTRY_HPP
+#define DDS_TOPIC_REGISTRY_HPP
+
+#include <cstddef>
+
+/*
+ * topic_registry - compile-time topic and QoS-profile registry
+ *
+ * The generated constants in Definitions.hpp are global const std::string
+ * objects: every process pays static-init heap allocations for dozens of
+ * strings, and a typo in a profile string ("DataPatternLibrary::..." for
+ * "DataPatternsLibrary::...") is only caught at runtime when entity
+ * creation fails. This registry provides the same names as constexpr
+ * data, keyed by an enum:
+ *
+ *   DDSWriterSetup<foxglove::PointCloud> writer(
+ *           participant_setup, topic_registry::TopicId::POINT_CLOUD);
+ *
+ * The enum overloads of the setup-class constructors resolve topic name
+ * and default QoS profile with an indexed table lookup - no allocations,
+ * and an unknown topic or misspelled profile is a compile error instead
+ * of a shipped failure. The string-typed constructors remain for topics
+ * or profile pairings outside the table (command-override strengths,
+ * benchmark topics whose payload type is a template parameter).
+ *
+ * The table mirrors Definitions.idl, which stays the source of truth for
+ * the string constants; keep the two in sync when adding a topic. The
+ * default profile per topic is the pairing the example apps ship with.
+ * (Definitions.idl would generate std::string_view constants under
+ * C++17; this tree builds as C++14, so the registry uses const char*.)
+ */
+namespace topic_registry {
+
+    enum class TopicId : std::size_t {
+        COMMAND = 0,
+        POSITION,
+        STATE,
+        BUTTON,
+        IMAGE,
+        FINAL_FLAT_IMAGE,
+        POINT_CLOUD,
+        CONFIG,
+        APP_CONFIG,
+        GEOJSON,
+        TRANSFORM,
+        TELEMETRY,
+        FLAT_IMAGE,
+        PERF_COUNTERS,
+        BENCHMARK_PING,
+        BENCHMARK_PONG,
+        BENCHMARK_STREAM,
+        PARAMETER_EVENTS,
+        SET_PARAMETERS_REQUEST,
+        SET_PARAMETERS_RESPONSE,
+        GET_PARAMETERS_REQUEST,
+        GET_PARAMETERS_RESPONSE,
+        LIST_PARAMETERS_REQUEST,
+        LIST_PARAMETERS_RESPONSE,
+        TOPIC_COUNT  // keep last
+    };
+
+    struct TopicEntry {
+        TopicId id;
+        const char *topic_name;
+        // Registered type the example apps pair with the topic; empty for
+        // topics whose payload type is chosen per app (benchmark topics)
+        const char *type_name;
+        const char *default_qos_profile;
+    };
+
+    // One row per TopicId, in enum order (checked below)
+    constexpr TopicEntry TOPIC_TABLE[] = {
+        { TopicId::COMMAND, "Command",
+          "example_types::Command", "DataPatternsLibrary::AssignerQoS" },
+        { TopicId::POSITION, "Position",
+          "example_types::Position", "DataPatternsLibrary::AssignerQoS" },
+        { TopicId::STATE, "State",
+          "example_types::State", "DataPatternsLibrary::StatusQoS" },
+        { TopicId::BUTTON, "Button",
+          "example_types::Button", "DataPatternsLibrary::AssignerQoS" },
+        { TopicId::IMAGE, "Image",
+          "example_types::Image", "DataPatternsLibrary::LargeDataSHMEMQoS" },
+        { TopicId::FINAL_FLAT_IMAGE, "FinalFlatImage",
+          "example_types::FinalFlatImage",
+          "DataPatternsLibrary::LargeDataSHMEM_ZCQoS" },
+        { TopicId::POINT_CLOUD, "PointCloud",
+          "foxglove::PointCloud", "DataPatternsLibrary::LargeDataSHMEMQoS" },
+        { TopicId::CONFIG, "Config",
+          "example_types::Config", "DataPatternsLibrary::AssignerQoS" },
+        { TopicId::APP_CONFIG, "AppConfig",
+          "example_types::AppConfig", "DataPatternsLibrary::AssignerQoS" },
+        { TopicId::GEOJSON, "GeoJSON",
+          "foxglove::GeoJSON", "DataPatternsLibrary::AssignerQoS" },
+        { TopicId::TRANSFORM, "FrameTransform",
+          "foxglove::FrameTransforms",
+          "DataPatternsLibrary::LargeDataSHMEMQoS" },
+        { TopicId::TELEMETRY, "Telemetry",
+          "example_types::Command",
+          "DataPatternsLibrary::HighThroughputBatchQoS" },
+        { TopicId::FLAT_IMAGE, "FlatImage",
+          "foxglove::FlatRawImage",
+          "DataPatternsLibrary::LargeDataSHMEM_ZCQoS" },
+        { TopicId::PERF_COUNTERS, "EntityPerfCounters",
+          "example_types::EntityPerfCounters",
+          "DataPatternsLibrary::StatusQoS" },
+        { TopicId::BENCHMARK_PING, "BenchmarkPing",
+          "", "DataPatternsLibrary::LargeDataSHMEMQoS" },
+        { TopicId::BENCHMARK_PONG, "BenchmarkPong",
+          "", "DataPatternsLibrary::LargeDataSHMEMQoS" },
+        { TopicId::BENCHMARK_STREAM, "BenchmarkStream",
+          "", "DataPatternsLibrary::LargeDataSHMEMQoS" },
+        { TopicId::PARAMETER_EVENTS, "ParameterEvents",
+          "example_types::ParameterEvent",
+          "DataPatternsLibrary::ParameterQoS" },
+        { TopicId::SET_PARAMETERS_REQUEST, "SetParametersRequest",
+          "example_types::SetParametersRequest",
+          "DataPatternsLibrary::ParameterQoS" },
+        { TopicId::SET_PARAMETERS_RESPONSE, "SetParametersResponse",
+          "example_types::SetParametersResponse",
+          "DataPatternsLibrary::ParameterQoS" },
+        { TopicId::GET_PARAMETERS_REQUEST, "GetParametersRequest",
+          "example_types::GetParametersRequest",
+          "DataPatternsLibrary::ParameterQoS" },
+        { TopicId::GET_PARAMETERS_RESPONSE, "GetParametersResponse",
+          "example_types::GetParametersResponse",
+          "DataPatternsLibrary::ParameterQoS" },
+        { TopicId::LIST_PARAMETERS_REQUEST, "ListParametersRequest",
+          "example_types::ListParametersRequest",
+          "DataPatternsLibrary::ParameterQoS" },
+        { TopicId::LIST_PARAMETERS_RESPONSE, "ListParametersResponse",
+          "example_types::ListParametersResponse",
+          "DataPatternsLibrary::ParameterQoS" },
+    };
+
+    constexpr std::size_t TOPIC_TABLE_SIZE =
+            sizeof(TOPIC_TABLE) / sizeof(TOPIC_TABLE[0]);
+
+    // Verify each row sits at the index its TopicId says, so entry() can
+    // be a plain indexed lookup
+    constexpr bool table_is_in_enum_order(std::size_t index = 0)
+    {
+        return index == TOPIC_TABLE_SIZE
+                || (static_cast<std::size_t>(TOPIC_TABLE[index].id) == index
+                    && table_is_in_enum_order(index + 1));
+    }
+
+    static_assert(
+            TOPIC_TABLE_SIZE == static_cast<std::size_t>(TopicId::TOPIC_COUNT),
+            "TOPIC_TABLE must have one row per TopicId");
+    static_assert(
+            table_is_in_enum_order(),
+            "TOPIC_TABLE rows must be in TopicId enum order");
+
+    constexpr const TopicEntry &entry(TopicId id)
+    {
+        return TOPIC_TABLE[static_cast<std::size_t>(id)];
+    }
+
+    constexpr const char *name(TopicId id)
+    {
+        return entry(id).topic_name;
+    }
+
+    constexpr const char *type_name(TopicId id)
+    {
+        return entry(id).type_name;
+    }
+
+    constexpr const char *default_qos_profile(TopicId id)
+    {
+        return entry(id).default_qos_profile;
+    }
+
+}  // namespace topic_registry
+
+#endif  // DDS_TOPIC_REGISTRY_HPP
@@ -16,9 +16,18 @@
 #include <rti/rti.hpp>  // Include necessary DDS headers
 #include <rti/core/cond/AsyncWaitSet.hpp>
 #include <string>       // Include string header
+#include <chrono>
 #include <iostream>
 #include <functional>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include "DDSAsyncLogger.hpp"
 #include "DDSParticipantSetup.hpp"
+#include "DDSPerfTelemetry.hpp"
+#include "DDSTopicRegistry.hpp"
 
 using namespace rti::all;
 
@@ -35,6 +44,21 @@ using namespace rti::all;
  *   - AsyncWaitSet Integration: Registers status conditions with the centralized AsyncWaitSet
  *                                allowing all status events to be processed asynchronously via
  *                                thread pool without blocking the application
+ *   - Loan Pool Helpers: For FlatData/Zero-Copy types, reserve_loans() warms the
+ *                        writer's loan pool at startup and try_get_loan() acquires
+ *                        loans without blocking, counting pool exhaustion so
+ *                        back-pressure is visible instead of silently stalling
+ *   - Batch Flush: flush() pushes out the writer's partial batch on demand
+ *                  when a batching profile (HIGH_THROUGHPUT_BATCH) is in use
+ *
+ * Default status handlers log through DDSAsyncLogger rather than writing to
+ * std::cout directly, keeping the AsyncWaitSet pool threads off the iostream
+ * lock when status events burst.
+ *
+ * A per-writer DDSEntityCounters block (write duration via timed_write,
+ * FlatData loan wait via try_get_loan) is registered with DDSPerfTelemetry
+ * so the counters can be published on the EntityPerfCounters topic and
+ * graphed with tools/rti_view.
  */
 template <typename T>
 class DDSWriterSetup {
@@ -52,23 +76,23 @@ public:
     using OfferedIncompatibleQosFunction =
             std::function<void(dds::pub::DataWriter<T> &)>;
 
-    // Constructor accepting a DDSParticipantSetup for Writer setup
+    // Constructor accepting a DDSParticipantSetup for Writer setup.
+    // waitset_lane selects a named AsyncWaitSet lane created via
+    // DDSParticipantSetup::add_waitset_lane; empty selects the default lane.
     explicit DDSWriterSetup(
             std::shared_ptr<DDSParticipantSetup> &p_setup,
             const std::string &topic_name,
-            const std::string &qos_profile = "")
-            : _participant(p_setup->participant()),
-              _async_waitset(p_setup->async_waitset()),
+            const std::string &qos_profile = "",
+            const std::string &waitset_lane = "")
+            : _participant_setup(p_setup),
+              _participant(p_setup->participant()),
+              _async_waitset(p_setup->async_waitset(waitset_lane)),
               _topic_name(topic_name),
               _qos_file(p_setup->qos_file_path()),
               _qos_profile(qos_profile)
     {
         std::cout << "Created DDS Writer Setup Class" << std::endl;
 
-        if (!_qos_file.empty()) {
-            _qos_provider = dds::core::QosProvider(_qos_file);
-        }
-
         // If Topic not already created, create new
         _topic = dds::topic::find<dds::topic::Topic<T>>(
                 _participant,
@@ -84,9 +108,11 @@ public:
         std::cout << "Creating Writer..." << std::endl;
 
         if (!_qos_file.empty() && !_qos_profile.empty()) {
+            // QoS comes from the participant setup's shared, memoized provider
+            // so the XML file is not re-parsed per entity
             _writer = dds::pub::DataWriter<T>(
                     _topic,
-                    _qos_provider.extensions().datawriter_qos_w_topic_name(
+                    _participant_setup->datawriter_qos(
                             _qos_profile,
                             _topic_name));
 
@@ -103,6 +129,10 @@ public:
 
         // Setup default status handler directly
         if (_writer != dds::core::null) {
+            // Register this writer's performance counter block
+            _perf_counters = DDSPerfTelemetry::instance().register_entity(
+                    _topic_name + ".writer");
+
             std::cout << "Setting up status condition for " << _topic_name << std::endl;
             _status_condition = dds::core::cond::StatusCondition(_writer);
             
@@ -131,6 +161,22 @@ public:
         }
     }
 
+    // Registry constructor: resolves topic name and default QoS profile
+    // from the compile-time table in DDSTopicRegistry.hpp, so an unknown
+    // topic or misspelled profile is a compile error rather than a
+    // runtime entity-creation failure
+    explicit DDSWriterSetup(
+            std::shared_ptr<DDSParticipantSetup> &p_setup,
+            topic_registry::TopicId topic,
+            const std::string &waitset_lane = "")
+            : DDSWriterSetup(
+                    p_setup,
+                    topic_registry::name(topic),
+                    topic_registry::default_qos_profile(topic),
+                    waitset_lane)
+    {
+    }
+
     // Destructor - detach conditions from AsyncWaitSet
     ~DDSWriterSetup()
     {
@@ -195,25 +241,183 @@ public:
         _offered_incompatible_qos_callback = handler;
     }
 
-    // Wait indefinitely for a number of DataReaders to match
-    void wait_for_drs_to_match(int expected_dr_matches)
+    // Waitable that completes once at least `count` DataReaders are matched.
+    // Driven by the already-attached publication_matched status condition -
+    // no polling thread, and a future requested after the matches happened
+    // completes immediately. Compose several endpoints' futures with
+    // match_utils::all_of to block once for the whole entity graph.
+    std::shared_future<void> match_future(int count)
     {
-        if (expected_dr_matches <= 0) {
+        if (count <= 0) {
             throw std::invalid_argument(
-                    "Error: expected_dr_matches must be greater than 0");
+                    "Error: match count must be greater than 0");
         }
 
+        std::lock_guard<std::mutex> lock(_match_mutex);
+        std::promise<void> promise;
+        auto future = promise.get_future().share();
+        if (_writer.publication_matched_status().current_count() >= count) {
+            promise.set_value();  // already wired
+        } else {
+            _match_promises.emplace_back(count, std::move(promise));
+        }
+        return future;
+    }
+
+    // Wait indefinitely for a number of DataReaders to match
+    void wait_for_drs_to_match(int expected_dr_matches)
+    {
         std::cout << "Waiting indefinitely for DataReaders to match with the DataWriter..." << std::endl;
 
-        while (_writer.publication_matched_status().current_count() < expected_dr_matches
-            && !application::shutdown_requested) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto matched = match_future(expected_dr_matches);
+        // Wake periodically only so Ctrl+C can abort the wait - the future
+        // itself is completed by the status condition, not by polling
+        while (matched.wait_for(std::chrono::milliseconds(100))
+                       != std::future_status::ready
+               && !application::shutdown_requested) {
         }
         std::cout << "DataWriter matched with " +
                 std::to_string(_writer.publication_matched_status().current_count()) +
                 " DataReaders" << std::endl;
     };
 
+    // Write one sample, recording the write duration in the per-writer
+    // perf counters. Use in place of writer().write() where write latency
+    // should show up in the EntityPerfCounters telemetry (a reliable
+    // writer's write() can block on a full send window, and that stall is
+    // exactly what the counters exist to expose).
+    void timed_write(const T &sample)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        _writer.write(sample);
+        _perf_counters->record_write(elapsed_usec(start));
+    }
+
+    // Flush the writer's current batch immediately (RTI extension). Only
+    // meaningful with a batching profile such as HIGH_THROUGHPUT_BATCH,
+    // where samples accumulate until a size/time threshold; call this at
+    // the end of a publish burst so the tail samples don't sit in a partial
+    // batch waiting out max_flush_delay. No-op when batching is disabled.
+    void flush()
+    {
+        try {
+            _writer->flush();
+        } catch (const std::exception &e) {
+            std::cerr << "Error flushing writer on " << _topic_name << ": "
+                      << e.what() << std::endl;
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // Paced-burst helpers
+    // With an asynchronous publish-mode profile (PACED_BURST_LARGE_DATA_UDP)
+    // write() only queues the sample; the middleware's flow controller
+    // (the BurstShaper token bucket on PacedBurstUdpParticipant) shapes the
+    // wire bandwidth on its own thread. These helpers bound how far the
+    // producer runs ahead of acknowledgments without stop-and-wait.
+    // ------------------------------------------------------------------
+
+    // Samples still held in the writer queue: queued awaiting the flow
+    // controller, or sent but not yet acknowledged by every reliable reader
+    int64_t unacknowledged_sample_count()
+    {
+        try {
+            return _writer->datawriter_cache_status().sample_count();
+        } catch (const std::exception &e) {
+            std::cerr << "Error reading writer cache status on " << _topic_name
+                      << ": " << e.what() << std::endl;
+            return 0;
+        }
+    }
+
+    // Windowed acknowledgment: returns as soon as no more than
+    // max_outstanding samples are in flight, so the producer keeps queueing
+    // while earlier samples are still being sent and acknowledged -
+    // overlapping transmission with ack collection instead of draining the
+    // whole burst at the end. Returns false if the window was not reached
+    // within timeout_ms.
+    bool wait_for_ack_window(int64_t max_outstanding, int timeout_ms = 5000)
+    {
+        const auto deadline = std::chrono::steady_clock::now()
+                + std::chrono::milliseconds(timeout_ms);
+
+        while (unacknowledged_sample_count() > max_outstanding) {
+            if (std::chrono::steady_clock::now() >= deadline
+                || application::shutdown_requested) {
+                return false;
+            }
+            try {
+                // Short bounded wait; acknowledgments arriving during the
+                // wait complete it early
+                _writer.wait_for_acknowledgments(
+                        dds::core::Duration::from_millisecs(10));
+            } catch (const std::exception &) {
+                // Timeout while samples remain in flight - loop and
+                // re-check the window
+            }
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------
+    // FlatData / Zero-Copy loan pool helpers
+    // Only valid for types with @language_binding(FLAT_DATA); class-template
+    // member functions are only instantiated when called, so non-FlatData
+    // writers are unaffected.
+    // ------------------------------------------------------------------
+
+    // Warm the writer's loan pool by acquiring pool_depth loans up front and
+    // returning them unwritten. This forces the middleware to allocate (and
+    // fault in) the shared-memory buffers at startup so the first frames of a
+    // high-rate stream don't pay the allocation cost. The pool depth itself
+    // is bounded by writer_loaned_sample_allocation in the QoS profile;
+    // asking for more than the QoS allows stops early.
+    void reserve_loans(int pool_depth)
+    {
+        std::vector<T *> warmed;
+        warmed.reserve(pool_depth);
+        try {
+            for (int i = 0; i < pool_depth; i++) {
+                warmed.push_back(_writer->get_loan());
+            }
+        } catch (const std::exception &e) {
+            std::cout << "Loan pool warm-up stopped after " << warmed.size()
+                      << " of " << pool_depth << " loans: " << e.what()
+                      << std::endl;
+        }
+        for (auto *sample : warmed) {
+            _writer->discard_loan(*sample);
+        }
+        std::cout << "Warmed " << warmed.size() << " writer loans for "
+                  << _topic_name << std::endl;
+    }
+
+    // Non-blocking loan acquisition for FlatData/Zero-Copy publishing.
+    // Returns nullptr instead of failing when the loan pool is exhausted
+    // (all buffers in flight/unacknowledged) and counts the exhaustion so
+    // the application can drop a frame knowingly rather than stall the
+    // publish loop. Recycled buffers come back with their payload region
+    // untouched, so a large frame buffer is only faulted in once.
+    T *try_get_loan()
+    {
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            T *loan = _writer->get_loan();
+            _perf_counters->record_loan_wait(elapsed_usec(start));
+            return loan;
+        } catch (const std::exception &) {
+            _loan_exhaustion_count.fetch_add(1, std::memory_order_relaxed);
+            _perf_counters->record_loan_wait(elapsed_usec(start));
+            return nullptr;
+        }
+    }
+
+    // Number of try_get_loan calls rejected because the pool was exhausted
+    size_t loan_exhaustion_count() const
+    {
+        return _loan_exhaustion_count.load(std::memory_order_relaxed);
+    }
+
     // Getter for DataWriter
     dds::pub::DataWriter<T> writer() const
     {
@@ -234,53 +438,69 @@ public:
 
 private:
 
+    // Microseconds elapsed since `start`, for the perf counter records
+    static uint64_t elapsed_usec(
+            const std::chrono::steady_clock::time_point &start)
+    {
+        return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+    }
+
     // Default handler for publication matched events
     void _default_on_publication_matched()
     {
         auto status = _writer.publication_matched_status();
-        
-        std::cout << "[Writer] Publication matched event for topic: " 
-                  << _writer.topic().name() << std::endl;
-        std::cout << "  Current count: " << status.current_count() << std::endl;
-        std::cout << "  Current count change: " << status.current_count_change() 
-                  << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() 
-                  << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Writer] Publication matched event for topic: "
+            << _writer.topic().name()
+            << " | current: " << status.current_count()
+            << " (change " << status.current_count_change() << ")"
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")";
+        DDS_LOG_INFO(msg.str());
     }
 
     // Default handler for liveliness lost events
     void _default_on_liveliness_lost()
     {
         auto status = _writer.liveliness_lost_status();
-        
-        std::cout << "[Writer] Liveliness lost event for topic: " 
-                  << _writer.topic().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Writer] Liveliness lost event for topic: "
+            << _writer.topic().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")";
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Default handler for offered deadline missed events
     void _default_on_offered_deadline_missed()
     {
         auto status = _writer.offered_deadline_missed_status();
-        
-        std::cout << "[Writer] Offered deadline missed event for topic: " 
-                  << _writer.topic().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Writer] Offered deadline missed event for topic: "
+            << _writer.topic().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")";
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Default handler for offered incompatible QoS events
     void _default_on_offered_incompatible_qos()
     {
         auto status = _writer.offered_incompatible_qos_status();
-        
-        std::cout << "[Writer] Offered incompatible QoS event for topic: " 
-                  << _writer.topic().name() << std::endl;
-        std::cout << "  Total count: " << status.total_count() << std::endl;
-        std::cout << "  Total count change: " << status.total_count_change() << std::endl;
-        std::cout << "  Last policy: " << status.last_policy_id() << std::endl;
+
+        std::ostringstream msg;
+        msg << "[Writer] Offered incompatible QoS event for topic: "
+            << _writer.topic().name()
+            << " | total: " << status.total_count()
+            << " (change " << status.total_count_change() << ")"
+            << " | last policy: " << status.last_policy_id();
+        DDS_LOG_WARNING(msg.str());
     }
 
     // Handler that checks which status triggered and dispatches accordingly
@@ -295,6 +515,7 @@ private:
             } else {
                 _default_on_publication_matched();
             }
+            _notify_match_waiters();
         }
         
         // Check if liveliness lost status triggered
@@ -325,6 +546,26 @@ private:
         }
     }
 
+    // Complete every pending match future whose threshold is reached
+    void _notify_match_waiters()
+    {
+        const int current =
+                _writer.publication_matched_status().current_count();
+        std::lock_guard<std::mutex> lock(_match_mutex);
+        for (auto it = _match_promises.begin(); it != _match_promises.end();) {
+            if (current >= it->first) {
+                it->second.set_value();
+                it = _match_promises.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Keep the participant setup alive - owns the shared QosProvider and
+    // the memoized QoS caches used at construction time
+    std::shared_ptr<DDSParticipantSetup> _participant_setup;
+
     dds::domain::DomainParticipant _participant = dds::core::null;
 
     // Async Waitset - reference to the one owned by DDSParticipantSetup
@@ -333,11 +574,20 @@ private:
     dds::pub::DataWriter<T> _writer = dds::core::null;
     dds::topic::Topic<T> _topic = dds::core::null;
     dds::core::cond::StatusCondition _status_condition = dds::core::null;
-    dds::core::QosProvider _qos_provider = dds::core::null;
     const std::string _topic_name;
     const std::string _qos_file;
     const std::string _qos_profile;
 
+    // try_get_loan rejections due to loan pool exhaustion
+    std::atomic<size_t> _loan_exhaustion_count{0};
+
+    // Per-writer performance counter block (registered with DDSPerfTelemetry)
+    std::shared_ptr<DDSEntityCounters> _perf_counters;
+
+    // Pending match futures: (match threshold, promise)
+    std::mutex _match_mutex;
+    std::vector<std::pair<int, std::promise<void>>> _match_promises;
+
     // Registered status callbacks
     PublicationMatchedFunction _publication_matched_callback;
     LivelinessLostFunction _liveliness_lost_callback;
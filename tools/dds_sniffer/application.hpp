@@ -0,0 +1,236 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef APPLICATION_HPP
+#define APPLICATION_HPP
+
+#include <iostream>
+#include <csignal>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <dds/core/ddscore.hpp>
+#include "Definitions.hpp"
+
+namespace application {
+
+    // Catch control-C and tell application to shut down
+    bool shutdown_requested = false;
+
+    inline void stop_handler(int)
+    {
+        shutdown_requested = true;
+        std::cout << "preparing to shut down..." << std::endl;
+    }
+
+    inline void setup_signal_handlers()
+    {
+        signal(SIGINT, stop_handler);
+        signal(SIGTERM, stop_handler);
+    }
+
+    enum class ParseReturn {
+        ok,
+        failure,
+        exit
+    };
+
+    struct ApplicationArguments {
+        ParseReturn parse_result;
+        unsigned int domain_id;
+        rti::config::Verbosity verbosity;
+        std::string qos_file_path;
+        std::string topic_name;
+        unsigned int keep_one_in_n;
+        double max_rate_hz;
+        std::vector<std::string> fields;
+        std::string tap_file_path;
+
+        ApplicationArguments(
+            ParseReturn parse_result_param,
+            unsigned int domain_id_param,
+            rti::config::Verbosity verbosity_param,
+            const std::string& qos_file_path_param,
+            const std::string& topic_name_param,
+            unsigned int keep_one_in_n_param,
+            double max_rate_hz_param,
+            const std::vector<std::string>& fields_param,
+            const std::string& tap_file_path_param)
+            : parse_result(parse_result_param),
+            domain_id(domain_id_param),
+            verbosity(verbosity_param),
+            qos_file_path(qos_file_path_param),
+            topic_name(topic_name_param),
+            keep_one_in_n(keep_one_in_n_param),
+            max_rate_hz(max_rate_hz_param),
+            fields(fields_param),
+            tap_file_path(tap_file_path_param) {}
+    };
+
+    inline void set_verbosity(
+        rti::config::Verbosity& verbosity,
+        int verbosity_value)
+    {
+        std::cout << "Setting verbosity to value: ";
+        switch (verbosity_value) {
+            case 0:
+            verbosity = rti::config::Verbosity::SILENT;
+            std::cout << "0-SILENT" << std::endl;
+            break;
+            case 1:
+            verbosity = rti::config::Verbosity::EXCEPTION;
+            std::cout << "1-EXCEPTION" << std::endl;
+            break;
+            case 2:
+            verbosity = rti::config::Verbosity::WARNING;
+            std::cout << "2-WARNING" << std::endl;
+            break;
+            case 3:
+            verbosity = rti::config::Verbosity::STATUS_LOCAL;
+            std::cout << "3-STATUS_LOCAL" << std::endl;
+            break;
+            case 4:
+            verbosity = rti::config::Verbosity::STATUS_REMOTE;
+            std::cout << "4-STATUS_REMOTE" << std::endl;
+            break;
+            case 5:
+            verbosity = rti::config::Verbosity::STATUS_ALL;
+            std::cout << "5-STATUS_ALL" << std::endl;
+            break;
+            default:
+            verbosity = rti::config::Verbosity::EXCEPTION;
+            break;
+        }
+    }
+
+    // Split a comma-separated member list ("id,lat,lon") into names
+    inline std::vector<std::string> parse_field_list(const std::string &list)
+    {
+        std::vector<std::string> fields;
+        std::stringstream stream(list);
+        std::string field;
+        while (std::getline(stream, field, ',')) {
+            if (!field.empty()) {
+                fields.push_back(field);
+            }
+        }
+        return fields;
+    }
+
+    // Parses application arguments for example.
+    inline ApplicationArguments parse_arguments(int argc, char *argv[])
+    {
+        int arg_processing = 1;
+        bool show_usage = false;
+        ParseReturn parse_result = ParseReturn::ok;
+        unsigned int domain_id = domains::DEFAULT_DOMAIN_ID;
+        rti::config::Verbosity verbosity(rti::config::Verbosity::EXCEPTION);
+        std::string qos_file_path = "dds/qos/DDS_QOS_PROFILES.xml"; // Default QoS file
+        std::string topic_name = "";
+        unsigned int keep_one_in_n = 1;
+        double max_rate_hz = 0.0;
+        std::vector<std::string> fields;
+        std::string tap_file_path = "";
+
+        while (arg_processing < argc) {
+            if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-d") == 0
+            || strcmp(argv[arg_processing], "--domain") == 0)) {
+                domain_id = atoi(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-v") == 0
+            || strcmp(argv[arg_processing], "--verbosity") == 0)) {
+                set_verbosity(verbosity, atoi(argv[arg_processing + 1]));
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-q") == 0
+            || strcmp(argv[arg_processing], "--qos-file") == 0)) {
+                qos_file_path = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-t") == 0
+            || strcmp(argv[arg_processing], "--topic") == 0)) {
+                topic_name = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-k") == 0
+            || strcmp(argv[arg_processing], "--keep") == 0)) {
+                keep_one_in_n = atoi(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-r") == 0
+            || strcmp(argv[arg_processing], "--max-rate") == 0)) {
+                max_rate_hz = atof(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-f") == 0
+            || strcmp(argv[arg_processing], "--fields") == 0)) {
+                fields = parse_field_list(argv[arg_processing + 1]);
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-o") == 0
+            || strcmp(argv[arg_processing], "--tap") == 0)) {
+                tap_file_path = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if (strcmp(argv[arg_processing], "-h") == 0
+            || strcmp(argv[arg_processing], "--help") == 0) {
+                std::cout << "High-rate DynamicData topic sniffer (C++ replacement for rti_spy on hot topics)." << std::endl;
+                show_usage = true;
+                parse_result = ParseReturn::exit;
+                break;
+            } else {
+                std::cout << "Bad parameter." << std::endl;
+                show_usage = true;
+                parse_result = ParseReturn::failure;
+                break;
+            }
+        }
+
+        if (parse_result == ParseReturn::ok && topic_name.empty()) {
+            std::cout << "Missing required parameter: -t/--topic" << std::endl;
+            show_usage = true;
+            parse_result = ParseReturn::failure;
+        }
+
+        if (show_usage) {
+            std::cout << "Usage:\n"\
+            "    -t, --topic        <str>   Topic name to sniff (required).\n"\
+            "    -d, --domain       <int>   Domain ID this application will\n" \
+            "                               subscribe in.  \n"
+            "                               Default: 1\n"\
+            "    -k, --keep         <int>   Keep 1 sample in N (application-level\n"\
+            "                               decimation).\n"\
+            "                               Default: 1 (keep all)\n"\
+            "    -r, --max-rate     <flt>   Cap delivery rate via TIME_BASED_FILTER.\n"\
+            "                               Default: 0 (uncapped)\n"\
+            "    -f, --fields       <str>   Comma-separated member names to print\n"\
+            "                               (field projection).\n"\
+            "                               Default: print the whole sample\n"\
+            "    -o, --tap          <str>   Binary tap: dump raw CDR records to this\n"\
+            "                               file instead of printing.\n"\
+            "    -v, --verbosity    <int>   How much debugging output to show.\n"\
+            "                               Range: 0-5 \n"
+            "                               Default: 1\n"
+            "    -q, --qos-file     <str>   Path to QoS profile XML file.\n"\
+            "                               Default: dds/qos/DDS_QOS_PROFILES.xml"
+            << std::endl;
+        }
+
+        return ApplicationArguments(parse_result, domain_id, verbosity,
+                qos_file_path, topic_name, keep_one_in_n, max_rate_hz, fields,
+                tap_file_path);
+    }
+
+}  // namespace application
+
+#endif  // APPLICATION_HPP
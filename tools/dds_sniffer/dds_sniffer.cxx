@@ -0,0 +1,375 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2025.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+/*
+ * dds_sniffer - native C++ DynamicData topic sniffer
+ *
+ * tools/rti_spy is a Python DynamicData inspector and falls over above a few
+ * hundred samples per second, so 60 fps image or 500 Hz status topics cannot
+ * be inspected live. This tool keeps up with production rates:
+ *
+ *   - The type is discovered from the builtin publication data, so no IDL
+ *     or code generation is needed for the sniffed topic
+ *   - The reader preallocates its DynamicData sample buffers (fast-pool
+ *     memory manager), so steady state does no per-sample allocation
+ *   - Decimation before formatting: a TIME_BASED_FILTER rate cap thins the
+ *     flow middleware-side (-r), and keep-1-in-N (-k) thins it in the loop
+ *   - Field projection (-f a,b,c) accesses only the named members instead
+ *     of formatting whole 3 MB samples
+ *   - Binary tap mode (-o file) skips formatting entirely and appends raw
+ *     CDR records ([uint32 length][bytes]) for offline decode
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// include both the standard APIs and extensions
+#include <rti/rti.hpp>
+#include <rti/config/Logger.hpp>
+#include <dds/core/xtypes/DynamicData.hpp>
+#include <dds/core/xtypes/DynamicType.hpp>
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "Definitions.hpp"
+#include "DDSParticipantSetup.hpp"
+
+// For example legibility.
+using namespace rti::all;
+using dds::core::xtypes::DynamicData;
+using dds::core::xtypes::DynamicType;
+using dds::core::xtypes::TypeKind;
+
+const std::string APP_NAME = "DDS Sniffer";
+constexpr int REPORT_INTERVAL_SEC = 1;
+
+// Wait until a writer of the requested topic is discovered and return its
+// type, learned from the builtin publication data. Polling the builtin
+// reader is fine here: discovery is a one-time startup cost, the hot path
+// starts afterwards.
+dds::core::optional<DynamicType> discover_topic_type(
+        dds::domain::DomainParticipant &participant,
+        const std::string &topic_name)
+{
+    std::vector<dds::sub::DataReader<dds::topic::PublicationBuiltinTopicData>>
+            builtin_readers;
+    dds::sub::find<
+            dds::sub::DataReader<dds::topic::PublicationBuiltinTopicData>>(
+            dds::sub::builtin_subscriber(participant),
+            dds::topic::publication_topic_name(),
+            std::back_inserter(builtin_readers));
+    if (builtin_readers.empty()) {
+        std::cerr << "No builtin publication reader available" << std::endl;
+        return dds::core::optional<DynamicType>();
+    }
+
+    std::cout << "Waiting for a writer of topic '" << topic_name
+              << "' to be discovered..." << std::endl;
+
+    while (!application::shutdown_requested) {
+        auto publications = builtin_readers[0].take();
+        for (const auto &publication : publications) {
+            if (!publication.info().valid()) {
+                continue;
+            }
+            if (publication.data().topic_name() != topic_name) {
+                continue;
+            }
+            if (!publication.data().type().is_set()) {
+                std::cerr << "Writer of '" << topic_name
+                          << "' does not propagate its type (TypeObject "
+                          << "disabled?); cannot sniff it" << std::endl;
+                return dds::core::optional<DynamicType>();
+            }
+            std::cout << "Discovered type '" << publication.data().type_name()
+                      << "' for topic '" << topic_name << "'" << std::endl;
+            return publication.data().type();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return dds::core::optional<DynamicType>();
+}
+
+// Print one projected member. Only the named member is accessed, so the
+// rest of the sample is never formatted - that is the point of projection
+// on topics with multi-MB payload members.
+void print_member(
+        const DynamicData &data,
+        const std::string &member_name,
+        std::ostringstream &os)
+{
+    os << member_name << "=";
+    if (!data.member_exists(member_name)) {
+        os << "<missing>";
+        return;
+    }
+
+    auto member_info = data.member_info(member_name);
+    switch (member_info.member_kind().underlying()) {
+    case TypeKind::BOOLEAN_TYPE:
+        os << (data.value<bool>(member_name) ? "true" : "false");
+        break;
+    case TypeKind::CHAR_8_TYPE:
+        os << data.value<char>(member_name);
+        break;
+    case TypeKind::UINT_8_TYPE:
+        os << static_cast<unsigned int>(data.value<uint8_t>(member_name));
+        break;
+    case TypeKind::INT_16_TYPE:
+        os << data.value<int16_t>(member_name);
+        break;
+    case TypeKind::UINT_16_TYPE:
+        os << data.value<uint16_t>(member_name);
+        break;
+    case TypeKind::INT_32_TYPE:
+        os << data.value<int32_t>(member_name);
+        break;
+    case TypeKind::UINT_32_TYPE:
+        os << data.value<uint32_t>(member_name);
+        break;
+    case TypeKind::INT_64_TYPE:
+        os << data.value<int64_t>(member_name);
+        break;
+    case TypeKind::UINT_64_TYPE:
+        os << data.value<uint64_t>(member_name);
+        break;
+    case TypeKind::FLOAT_32_TYPE:
+        os << data.value<float>(member_name);
+        break;
+    case TypeKind::FLOAT_64_TYPE:
+        os << data.value<double>(member_name);
+        break;
+    case TypeKind::ENUMERATION_TYPE:
+        os << data.value<int32_t>(member_name);
+        break;
+    case TypeKind::STRING_TYPE:
+        os << "\"" << data.value<std::string>(member_name) << "\"";
+        break;
+    default:
+        // Arrays, sequences, nested structs: report size only
+        os << "<" << member_info.element_count() << " elements>";
+        break;
+    }
+}
+
+void run(
+        std::shared_ptr<DDSParticipantSetup> participant_setup,
+        const application::ApplicationArguments &arguments)
+{
+    // Learn the type from discovery - no IDL needed for the sniffed topic
+    auto topic_type = discover_topic_type(
+            participant_setup->participant(),
+            arguments.topic_name);
+    if (!topic_type.is_set()) {
+        return;
+    }
+
+    dds::topic::Topic<DynamicData> topic(
+            participant_setup->participant(),
+            arguments.topic_name,
+            *topic_type);
+
+    // Sniffer QoS: best-effort keep-last so we never apply back-pressure to
+    // the sniffed writer, a rate cap if requested, and a preallocated
+    // fast-pool for the DynamicData sample buffers so a 3 MB image sample
+    // does not cost an allocation per take.
+    dds::sub::qos::DataReaderQos reader_qos;
+    reader_qos << dds::core::policy::History::KeepLast(32);
+    if (arguments.max_rate_hz > 0) {
+        // Nanosecond resolution: a millisecond Duration truncates to 0
+        // (no filtering) for caps above 1 kHz
+        const int64_t separation_ns =
+                static_cast<int64_t>(1e9 / arguments.max_rate_hz);
+        if (separation_ns > 0) {
+            reader_qos << dds::core::policy::TimeBasedFilter(
+                    dds::core::Duration::from_nanosecs(separation_ns));
+        } else {
+            std::cerr << "Warning: -r " << arguments.max_rate_hz
+                      << " is above TIME_BASED_FILTER resolution; "
+                         "delivery is uncapped" << std::endl;
+        }
+    }
+    auto properties = reader_qos.policy<rti::core::policy::Property>();
+    properties.set(
+            { "dds.data_reader.history.memory_manager.fast_pool."
+              "pool_buffer_max_size",
+              "4194304" },
+            false);
+    reader_qos << properties;
+
+    dds::sub::Subscriber subscriber(participant_setup->participant());
+    dds::sub::DataReader<DynamicData> reader(subscriber, topic, reader_qos);
+
+    // Binary tap: append [uint32 length][CDR bytes] records
+    std::ofstream tap_file;
+    const bool tap_mode = !arguments.tap_file_path.empty();
+    if (tap_mode) {
+        tap_file.open(
+                arguments.tap_file_path,
+                std::ios::binary | std::ios::trunc);
+        if (!tap_file.is_open()) {
+            std::cerr << "Cannot open tap file: " << arguments.tap_file_path
+                      << std::endl;
+            return;
+        }
+        std::cout << "Tap mode: raw CDR records -> " << arguments.tap_file_path
+                  << std::endl;
+    }
+
+    // Reused across samples: serialization buffer and projection formatter
+    std::vector<char> cdr_buffer;
+    cdr_buffer.reserve(4194304);
+    std::ostringstream projection;
+
+    dds::sub::cond::ReadCondition read_condition(
+            reader,
+            dds::sub::status::DataState(
+                    dds::sub::status::SampleState::not_read(),
+                    dds::sub::status::ViewState::any(),
+                    dds::sub::status::InstanceState::any()));
+    dds::core::cond::WaitSet waitset;
+    waitset += read_condition;
+
+    std::cout << "Sniffing '" << arguments.topic_name << "'"
+              << (arguments.keep_one_in_n > 1
+                          ? " (keep 1 in "
+                                    + std::to_string(arguments.keep_one_in_n)
+                                    + ")"
+                          : "")
+              << ". Press Ctrl+C to stop." << std::endl;
+
+    uint64_t received = 0;
+    uint64_t kept = 0;
+    uint64_t decimation_counter = 0;
+    auto report_time = std::chrono::steady_clock::now();
+    uint64_t received_at_report = 0;
+
+    while (!application::shutdown_requested) {
+        try {
+            waitset.wait(dds::core::Duration::from_millisecs(250));
+        } catch (const dds::core::TimeoutError &) {
+            // No data this interval - fall through to the rate report
+        }
+
+        auto samples = reader.take();
+        for (const auto &sample : samples) {
+            if (!sample.info().valid()) {
+                continue;
+            }
+            received++;
+
+            // Application-level keep-1-in-N decimation before any
+            // formatting or serialization work
+            if (arguments.keep_one_in_n > 1
+                && (decimation_counter++ % arguments.keep_one_in_n) != 0) {
+                continue;
+            }
+            kept++;
+
+            if (tap_mode) {
+                // Serialize into the reused buffer and append one record
+                cdr_buffer.clear();
+                dds::topic::topic_type_support<DynamicData>::to_cdr_buffer(
+                        cdr_buffer,
+                        sample.data());
+                const uint32_t length =
+                        static_cast<uint32_t>(cdr_buffer.size());
+                tap_file.write(
+                        reinterpret_cast<const char *>(&length),
+                        sizeof(length));
+                tap_file.write(cdr_buffer.data(), cdr_buffer.size());
+            } else if (!arguments.fields.empty()) {
+                // Field projection: only the named members are accessed
+                projection.str("");
+                projection << "[" << arguments.topic_name << "] ";
+                for (size_t i = 0; i < arguments.fields.size(); i++) {
+                    if (i > 0) {
+                        projection << " ";
+                    }
+                    print_member(
+                            sample.data(),
+                            arguments.fields[i],
+                            projection);
+                }
+                std::cout << projection.str() << "\n";
+            } else {
+                // Full sample print - fine for small/slow topics
+                std::cout << "[" << arguments.topic_name << "] "
+                          << sample.data() << "\n";
+            }
+        }
+
+        // Per-second rate report on stderr so it doesn't interleave with
+        // projected output being piped somewhere
+        auto now = std::chrono::steady_clock::now();
+        if (now - report_time >= std::chrono::seconds(REPORT_INTERVAL_SEC)) {
+            std::cerr << "[rate] " << (received - received_at_report)
+                      << " samples/s received, " << kept << " kept total"
+                      << std::endl;
+            received_at_report = received;
+            report_time = now;
+        }
+    }
+
+    if (tap_mode) {
+        tap_file.close();
+    }
+    std::cout << "Sniffer stopped. Received " << received << " samples, kept "
+              << kept << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    // Setup and Run the application
+    try {
+        // DDS Participant Setup (creates DomainParticipant and AsyncWaitSet;
+        // the sniffer polls its own reader, so a minimal pool is enough)
+        auto participant_setup = std::make_shared<DDSParticipantSetup>(
+                arguments.domain_id,
+                1,
+                arguments.qos_file_path,
+                qos_profiles::DEFAULT_PARTICIPANT,
+                APP_NAME);
+
+        rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+        // Run
+        run(participant_setup, arguments);
+
+    } catch (const std::exception &ex) {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Finalize participant factory after all DDS entities are cleaned up
+    dds::domain::DomainParticipant::finalize_participant_factory();
+    std::cout << "DomainParticipant factory finalized at application exit"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}